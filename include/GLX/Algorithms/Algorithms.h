@@ -0,0 +1,530 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Containers/DynamicArray.h"
+#include "GLX/Memory/MemoryUtils.h"
+#include "GLX/TypeTraits/EnableIf.h"
+#include "GLX/TypeTraits/PrimaryTypes.h"
+#include "GLX/TypeTraits/RemoveCVRef.h"
+#include "GLX/TypeTraits/RemoveReference.h"
+#include "GLX/TypeTraits/Trivial.h"
+#include "GLX/TypeTraits/TypeChooser.h"
+#include "GLX/Utils/BitUtils.h"
+
+class GlxLess
+{
+public:
+	template<typename TLhs, typename TRhs>
+	GLX_FORCE_INLINE GlxBool operator()(const TLhs& InLhs, const TRhs& InRhs) const
+	{
+		return InLhs < InRhs;
+	}
+};
+
+class GlxEqualTo
+{
+public:
+	template<typename TLhs, typename TRhs>
+	GLX_FORCE_INLINE GlxBool operator()(const TLhs& InLhs, const TRhs& InRhs) const
+	{
+		return InLhs == InRhs;
+	}
+};
+
+namespace GlxNsPrivate
+{
+	template<typename TKey>
+	class GlxRadixKey
+	{
+	public:
+		static_assert(GlxIsArithmetic<TKey>::Value && sizeof(TKey) <= 8, "Radix sort keys must be integers or floating point numbers of at most 64 bits");
+
+		using UnsignedType = typename GlxTypeChooser<sizeof(TKey) == 1, GlxUInt8,
+			typename GlxTypeChooser<sizeof(TKey) == 2, GlxUInt16,
+			typename GlxTypeChooser<sizeof(TKey) == 4, GlxUInt32, GlxUInt64>::Type>::Type>::Type;
+
+		// Maps the key to an unsigned integer whose ordering matches the ordering of the key.
+		static GLX_FORCE_INLINE UnsignedType ToUnsigned(TKey InKey)
+		{
+			UnsignedType Bits;
+			GLX_MEMCPY(&Bits, &InKey, sizeof(TKey));
+
+			const UnsignedType SignBit = static_cast<UnsignedType>(static_cast<UnsignedType>(1) << (sizeof(TKey) * 8 - 1));
+
+			if constexpr (GlxIsFloatingPoint<TKey>::Value)
+			{
+				return static_cast<UnsignedType>((Bits & SignBit) ? ~Bits : (Bits | SignBit));
+			}
+			else if constexpr (static_cast<TKey>(-1) < static_cast<TKey>(0))
+			{
+				return static_cast<UnsignedType>(Bits ^ SignBit);
+			}
+			else
+			{
+				return Bits;
+			}
+		}
+	};
+}
+
+// Sorting and searching on contiguous ranges. Every algorithm takes a pointer and an element count; the overloads taking
+// a container work with anything exposing GetData() and GetElementCount() (GlxDynamicArray, GlxStaticArray, ...).
+class GlxAlgorithms
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GLX_CONSTEXPR SizeType InvalidIndex = GLX_INVALID_INDEX;
+	static GLX_CONSTEXPR SizeType InsertionSortThreshold = 16;
+	static GLX_CONSTEXPR SizeType MergeSortRunLength = 32;
+
+	template<typename T, typename TLess = GlxLess>
+	static void InsertionSort(T* InData, SizeType InCount, TLess InLess = TLess())
+	{
+		for (SizeType Index = 1; Index < InCount; ++Index)
+		{
+			if (!InLess(InData[Index], InData[Index - 1]))
+			{
+				continue;
+			}
+
+			T Value(Move(InData[Index]));
+			SizeType Hole = Index;
+
+			do
+			{
+				InData[Hole] = Move(InData[Hole - 1]);
+				--Hole;
+			} while (Hole > 0 && InLess(Value, InData[Hole - 1]));
+
+			InData[Hole] = Move(Value);
+		}
+	}
+
+	template<typename T, typename TLess = GlxLess>
+	static void HeapSort(T* InData, SizeType InCount, TLess InLess = TLess())
+	{
+		for (SizeType Index = InCount / 2; Index-- > 0;)
+		{
+			SiftDown(InData, Index, InCount, InLess);
+		}
+
+		for (SizeType End = InCount - 1; End > 0; --End)
+		{
+			SwapElements(InData[0], InData[End]);
+			SiftDown(InData, 0, End, InLess);
+		}
+	}
+
+	// Introsort: median-of-three quicksort that falls back to heapsort once the recursion gets too deep and finishes
+	// small partitions with insertion sort. Not stable.
+	template<typename T, typename TLess = GlxLess>
+	static void Sort(T* InData, SizeType InCount, TLess InLess = TLess())
+	{
+		if (InCount > 1)
+		{
+			IntroSortImpl(InData, InCount, 2 * static_cast<SizeType>(GlxBitUtils::FloorLog2(static_cast<GlxUInt64>(InCount))), InLess);
+		}
+	}
+
+	// Top-down merge sort over insertion-sorted runs. Needs a scratch buffer of half the range.
+	template<typename T, typename TLess = GlxLess>
+	static void StableSort(T* InData, SizeType InCount, TLess InLess = TLess())
+	{
+		if (InCount <= MergeSortRunLength)
+		{
+			InsertionSort(InData, InCount, InLess);
+			return;
+		}
+
+		T* Buffer = static_cast<T*>(GLX_MALLOC(static_cast<GlxSizeT>((InCount + 1) / 2) * sizeof(T)));
+		MergeSortImpl(InData, InCount, Buffer, InLess);
+		GLX_FREE(Buffer);
+	}
+
+	// Merges the sorted ranges [0, InMid) and [InMid, InCount) in place. InBuffer is uninitialized storage for at least
+	// InMid elements.
+	template<typename T, typename TLess = GlxLess>
+	static void MergeAdjacent(T* InData, SizeType InMid, SizeType InCount, T* InBuffer, TLess InLess = TLess())
+	{
+		if (InMid <= 0 || InMid >= InCount || !InLess(InData[InMid], InData[InMid - 1]))
+		{
+			return;
+		}
+
+		GlxMemoryUtils::MoveConstructElements(InBuffer, InData, InMid);
+
+		SizeType Left = 0;
+		SizeType Right = InMid;
+		SizeType Out = 0;
+
+		while (Left < InMid && Right < InCount)
+		{
+			if (InLess(InData[Right], InBuffer[Left]))
+			{
+				InData[Out++] = Move(InData[Right++]);
+			}
+			else
+			{
+				InData[Out++] = Move(InBuffer[Left++]);
+			}
+		}
+
+		while (Left < InMid)
+		{
+			InData[Out++] = Move(InBuffer[Left++]);
+		}
+
+		GlxMemoryUtils::DestructElements(InBuffer, InMid);
+	}
+
+	// LSD radix sort on one byte per pass. InKeyFunc(const T&) returns an integer or floating point key; passes where
+	// every key has the same byte are skipped. Stable.
+	template<typename T, typename TKeyFunc>
+	static void RadixSort(T* InData, SizeType InCount, TKeyFunc InKeyFunc)
+	{
+		static_assert(GlxIsTriviallyCopyable<T>::Value, "RadixSort copies elements bitwise between passes");
+
+		using KeyType = typename GlxRemoveCVRef<decltype(InKeyFunc(*InData))>::Type;
+		using RadixKeyType = GlxNsPrivate::GlxRadixKey<KeyType>;
+
+		if (InCount < 2)
+		{
+			return;
+		}
+
+		T* Buffer = static_cast<T*>(GLX_MALLOC(static_cast<GlxSizeT>(InCount) * sizeof(T)));
+		T* Source = InData;
+		T* Dest = Buffer;
+		SizeType Counts[256];
+
+		for (GlxUInt32 Shift = 0; Shift < sizeof(KeyType) * 8; Shift += 8)
+		{
+			GLX_MEMSET(Counts, 0, sizeof(Counts));
+
+			for (SizeType Index = 0; Index < InCount; ++Index)
+			{
+				++Counts[(RadixKeyType::ToUnsigned(InKeyFunc(Source[Index])) >> Shift) & 0xFF];
+			}
+
+			if (Counts[(RadixKeyType::ToUnsigned(InKeyFunc(Source[0])) >> Shift) & 0xFF] == InCount)
+			{
+				continue;
+			}
+
+			SizeType Offset = 0;
+
+			for (SizeType Bucket = 0; Bucket < 256; ++Bucket)
+			{
+				const SizeType BucketCount = Counts[Bucket];
+				Counts[Bucket] = Offset;
+				Offset += BucketCount;
+			}
+
+			for (SizeType Index = 0; Index < InCount; ++Index)
+			{
+				Dest[Counts[(RadixKeyType::ToUnsigned(InKeyFunc(Source[Index])) >> Shift) & 0xFF]++] = Source[Index];
+			}
+
+			T* Temp = Source;
+			Source = Dest;
+			Dest = Temp;
+		}
+
+		if (Source != InData)
+		{
+			GLX_MEMCPY(InData, Source, static_cast<GlxSizeT>(InCount) * sizeof(T));
+		}
+
+		GLX_FREE(Buffer);
+	}
+
+	template<typename T>
+	static GLX_FORCE_INLINE void RadixSort(T* InData, SizeType InCount)
+	{
+		RadixSort(InData, InCount, [](const T& InValue) { return InValue; });
+	}
+
+	// Index of the first element not less than InValue.
+	template<typename T, typename TValue, typename TLess = GlxLess>
+	static SizeType LowerBound(const T* InData, SizeType InCount, const TValue& InValue, TLess InLess = TLess())
+	{
+		SizeType First = 0;
+
+		while (InCount > 0)
+		{
+			const SizeType Half = InCount / 2;
+
+			if (InLess(InData[First + Half], InValue))
+			{
+				First += Half + 1;
+				InCount -= Half + 1;
+			}
+			else
+			{
+				InCount = Half;
+			}
+		}
+
+		return First;
+	}
+
+	// Index of the first element greater than InValue.
+	template<typename T, typename TValue, typename TLess = GlxLess>
+	static SizeType UpperBound(const T* InData, SizeType InCount, const TValue& InValue, TLess InLess = TLess())
+	{
+		SizeType First = 0;
+
+		while (InCount > 0)
+		{
+			const SizeType Half = InCount / 2;
+
+			if (!InLess(InValue, InData[First + Half]))
+			{
+				First += Half + 1;
+				InCount -= Half + 1;
+			}
+			else
+			{
+				InCount = Half;
+			}
+		}
+
+		return First;
+	}
+
+	template<typename T, typename TValue, typename TLess = GlxLess>
+	static SizeType BinarySearch(const T* InData, SizeType InCount, const TValue& InValue, TLess InLess = TLess())
+	{
+		const SizeType Index = LowerBound(InData, InCount, InValue, InLess);
+		return (Index < InCount && !InLess(InValue, InData[Index])) ? Index : InvalidIndex;
+	}
+
+	// Moves the elements satisfying InPredicate to the front and returns how many there are. Not stable.
+	template<typename T, typename TPredicate>
+	static SizeType Partition(T* InData, SizeType InCount, TPredicate InPredicate)
+	{
+		SizeType First = 0;
+		SizeType Last = InCount;
+
+		while (true)
+		{
+			while (First < Last && InPredicate(InData[First]))
+			{
+				++First;
+			}
+
+			while (First < Last && !InPredicate(InData[Last - 1]))
+			{
+				--Last;
+			}
+
+			if (First >= Last)
+			{
+				return First;
+			}
+
+			SwapElements(InData[First], InData[Last - 1]);
+			++First;
+			--Last;
+		}
+	}
+
+	// Collapses runs of equal adjacent elements to their first element and returns the new element count. The elements
+	// past the returned count are left in a moved-from state.
+	template<typename T, typename TEqual = GlxEqualTo>
+	static SizeType Unique(T* InData, SizeType InCount, TEqual InEqual = TEqual())
+	{
+		if (InCount <= 0)
+		{
+			return 0;
+		}
+
+		SizeType Out = 0;
+
+		for (SizeType Index = 1; Index < InCount; ++Index)
+		{
+			if (!InEqual(InData[Out], InData[Index]) && ++Out != Index)
+			{
+				InData[Out] = Move(InData[Index]);
+			}
+		}
+
+		return Out + 1;
+	}
+
+	template<typename T, typename TAllocator, typename TEqual = GlxEqualTo>
+	static SizeType Unique(GlxDynamicArray<T, TAllocator>& InArray, TEqual InEqual = TEqual())
+	{
+		const SizeType NewCount = Unique(InArray.GetData(), InArray.GetElementCount(), InEqual);
+		InArray.RemoveAt(NewCount, InArray.GetElementCount() - NewCount);
+		return NewCount;
+	}
+
+	template<typename TContainer, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE void Sort(TContainer& InContainer, TLess InLess = TLess())
+	{
+		Sort(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InLess);
+	}
+
+	template<typename TContainer, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE void StableSort(TContainer& InContainer, TLess InLess = TLess())
+	{
+		StableSort(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InLess);
+	}
+
+	template<typename TContainer, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE void RadixSort(TContainer& InContainer)
+	{
+		RadixSort(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()));
+	}
+
+	template<typename TContainer, typename TValue, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE SizeType LowerBound(const TContainer& InContainer, const TValue& InValue, TLess InLess = TLess())
+	{
+		return LowerBound(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InValue, InLess);
+	}
+
+	template<typename TContainer, typename TValue, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE SizeType UpperBound(const TContainer& InContainer, const TValue& InValue, TLess InLess = TLess())
+	{
+		return UpperBound(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InValue, InLess);
+	}
+
+	template<typename TContainer, typename TValue, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE SizeType BinarySearch(const TContainer& InContainer, const TValue& InValue, TLess InLess = TLess())
+	{
+		return BinarySearch(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InValue, InLess);
+	}
+
+private:
+	template<typename T>
+	static GLX_FORCE_INLINE void SwapElements(T& InA, T& InB)
+	{
+		T Temp(Move(InA));
+		InA = Move(InB);
+		InB = Move(Temp);
+	}
+
+	template<typename T, typename TLess>
+	static void SiftDown(T* InData, SizeType InRoot, SizeType InCount, TLess& InLess)
+	{
+		T Value(Move(InData[InRoot]));
+		SizeType Child;
+
+		while ((Child = 2 * InRoot + 1) < InCount)
+		{
+			if (Child + 1 < InCount && InLess(InData[Child], InData[Child + 1]))
+			{
+				++Child;
+			}
+
+			if (!InLess(Value, InData[Child]))
+			{
+				break;
+			}
+
+			InData[InRoot] = Move(InData[Child]);
+			InRoot = Child;
+		}
+
+		InData[InRoot] = Move(Value);
+	}
+
+	template<typename T, typename TLess>
+	static void IntroSortImpl(T* InData, SizeType InCount, SizeType InDepthLimit, TLess& InLess)
+	{
+		while (InCount > InsertionSortThreshold)
+		{
+			if (InDepthLimit == 0)
+			{
+				HeapSort(InData, InCount, InLess);
+				return;
+			}
+
+			--InDepthLimit;
+
+			// Order the first, middle and last elements, then use the median as pivot at index 0. The smaller element
+			// left at the middle and the larger one at the end keep both partition scans in bounds.
+			const SizeType Mid = InCount / 2;
+			const SizeType Last = InCount - 1;
+
+			if (InLess(InData[Mid], InData[0]))
+			{
+				SwapElements(InData[Mid], InData[0]);
+			}
+
+			if (InLess(InData[Last], InData[Mid]))
+			{
+				SwapElements(InData[Last], InData[Mid]);
+
+				if (InLess(InData[Mid], InData[0]))
+				{
+					SwapElements(InData[Mid], InData[0]);
+				}
+			}
+
+			SwapElements(InData[0], InData[Mid]);
+
+			const T& Pivot = InData[0];
+			SizeType Left = 0;
+			SizeType Right = InCount;
+
+			while (true)
+			{
+				do
+				{
+					++Left;
+				} while (InLess(InData[Left], Pivot));
+
+				do
+				{
+					--Right;
+				} while (InLess(Pivot, InData[Right]));
+
+				if (Left >= Right)
+				{
+					break;
+				}
+
+				SwapElements(InData[Left], InData[Right]);
+			}
+
+			SwapElements(InData[0], InData[Right]);
+
+			// Recurse into the smaller side and loop on the larger one to bound the stack depth.
+			const SizeType LeftCount = Right;
+			const SizeType RightCount = InCount - Right - 1;
+
+			if (LeftCount < RightCount)
+			{
+				IntroSortImpl(InData, LeftCount, InDepthLimit, InLess);
+				InData += Right + 1;
+				InCount = RightCount;
+			}
+			else
+			{
+				IntroSortImpl(InData + Right + 1, RightCount, InDepthLimit, InLess);
+				InCount = LeftCount;
+			}
+		}
+
+		InsertionSort(InData, InCount, InLess);
+	}
+
+	template<typename T, typename TLess>
+	static void MergeSortImpl(T* InData, SizeType InCount, T* InBuffer, TLess& InLess)
+	{
+		if (InCount <= MergeSortRunLength)
+		{
+			InsertionSort(InData, InCount, InLess);
+			return;
+		}
+
+		const SizeType Mid = InCount / 2;
+
+		MergeSortImpl(InData, Mid, InBuffer, InLess);
+		MergeSortImpl(InData + Mid, InCount - Mid, InBuffer, InLess);
+		MergeAdjacent(InData, Mid, InCount, InBuffer, InLess);
+	}
+};
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "GLX/Containers/DynamicArray.h"
+#include "GLX/Threading/Atomic.h"
+#include "GLX/Threading/Thread.h"
+#include "GLX/TypeTraits/EnableIf.h"
+#include "GLX/TypeTraits/PrimaryTypes.h"
+#include "GLX/Utils/BitUtils.h"
+
+#include "Algorithms.h"
+
+// Parallel versions of the GlxAlgorithms sorts. Ranges below ParallelThreshold elements are sorted on the calling
+// thread; larger ranges are cut into one chunk per worker, the chunks are sorted concurrently and then merged pairwise.
+// Worker threads are started per call and the calling thread always takes part in the work.
+class GlxParallelAlgorithms
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GLX_CONSTEXPR SizeType ParallelThreshold = 1 << 16;
+
+	// Calls InFunc(TaskIndex) for every index in [0, InTaskCount) on up to InThreadCount threads. A thread count of 0
+	// uses one thread per hardware thread.
+	template<typename TFunc>
+	static void ParallelFor(SizeType InTaskCount, TFunc InFunc, SizeType InThreadCount = 0)
+	{
+		SizeType ThreadCount = InThreadCount > 0 ? InThreadCount : static_cast<SizeType>(GlxThreadUtils::GetNumberOfThreads());
+		ThreadCount = ThreadCount < InTaskCount ? ThreadCount : InTaskCount;
+
+		if (ThreadCount <= 1)
+		{
+			for (SizeType Task = 0; Task < InTaskCount; ++Task)
+			{
+				InFunc(Task);
+			}
+
+			return;
+		}
+
+		GlxAtomic<SizeType> NextTask(0);
+
+		auto Worker = [&NextTask, &InFunc, InTaskCount]()
+		{
+			for (SizeType Task = NextTask.fetch_add(1); Task < InTaskCount; Task = NextTask.fetch_add(1))
+			{
+				InFunc(Task);
+			}
+		};
+
+		GlxDynamicArray<GlxThread> Threads(ThreadCount - 1);
+
+		for (SizeType Index = 0; Index < ThreadCount - 1; ++Index)
+		{
+			Threads.EmplaceBack(Worker);
+		}
+
+		Worker();
+
+		for (GlxThread& Thread : Threads)
+		{
+			Thread.Join();
+		}
+	}
+
+	template<typename T, typename TLess = GlxLess>
+	static GLX_FORCE_INLINE void Sort(T* InData, SizeType InCount, TLess InLess = TLess(), SizeType InThreadCount = 0)
+	{
+		SortImpl<false>(InData, InCount, InLess, InThreadCount);
+	}
+
+	template<typename T, typename TLess = GlxLess>
+	static GLX_FORCE_INLINE void StableSort(T* InData, SizeType InCount, TLess InLess = TLess(), SizeType InThreadCount = 0)
+	{
+		SortImpl<true>(InData, InCount, InLess, InThreadCount);
+	}
+
+	template<typename TContainer, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE void Sort(TContainer& InContainer, TLess InLess = TLess(), SizeType InThreadCount = 0)
+	{
+		SortImpl<false>(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InLess, InThreadCount);
+	}
+
+	template<typename TContainer, typename TLess = GlxLess, typename = typename GlxEnableIf<!GlxIsPointer<TContainer>::Value>::Type>
+	static GLX_FORCE_INLINE void StableSort(TContainer& InContainer, TLess InLess = TLess(), SizeType InThreadCount = 0)
+	{
+		SortImpl<true>(InContainer.GetData(), static_cast<SizeType>(InContainer.GetElementCount()), InLess, InThreadCount);
+	}
+
+private:
+	template<GlxBool InIsStable, typename T, typename TLess>
+	static void SortImpl(T* InData, SizeType InCount, TLess& InLess, SizeType InThreadCount)
+	{
+		const SizeType ThreadCount = InThreadCount > 0 ? InThreadCount : static_cast<SizeType>(GlxThreadUtils::GetNumberOfThreads());
+
+		if (InCount < ParallelThreshold || ThreadCount <= 1)
+		{
+			if constexpr (InIsStable)
+			{
+				GlxAlgorithms::StableSort(InData, InCount, InLess);
+			}
+			else
+			{
+				GlxAlgorithms::Sort(InData, InCount, InLess);
+			}
+
+			return;
+		}
+
+		// A power-of-two chunk count lets every merge round pair up neighbouring runs of equal width.
+		const SizeType ChunkCount = static_cast<SizeType>(GlxBitUtils::RoundUpToPowerOfTwo(static_cast<GlxUInt64>(ThreadCount)));
+		const SizeType ChunkSize = (InCount + ChunkCount - 1) / ChunkCount;
+
+		ParallelFor(ChunkCount, [&](SizeType InChunk)
+		{
+			const SizeType Begin = InChunk * ChunkSize < InCount ? InChunk * ChunkSize : InCount;
+			const SizeType End = Begin + ChunkSize < InCount ? Begin + ChunkSize : InCount;
+
+			if constexpr (InIsStable)
+			{
+				GlxAlgorithms::StableSort(InData + Begin, End - Begin, InLess);
+			}
+			else
+			{
+				GlxAlgorithms::Sort(InData + Begin, End - Begin, InLess);
+			}
+		}, ThreadCount);
+
+		// Each merge only needs scratch space for its left run, so the pairs of a round use disjoint halves of one buffer.
+		T* Buffer = static_cast<T*>(GLX_MALLOC(static_cast<GlxSizeT>(ChunkCount * ChunkSize / 2) * sizeof(T)));
+
+		for (SizeType Width = ChunkSize; Width < InCount; Width *= 2)
+		{
+			const SizeType PairCount = (InCount + 2 * Width - 1) / (2 * Width);
+
+			ParallelFor(PairCount, [&](SizeType InPair)
+			{
+				const SizeType Begin = InPair * 2 * Width;
+				const SizeType Mid = Begin + Width;
+				const SizeType End = Mid + Width < InCount ? Mid + Width : InCount;
+
+				if (Mid < End)
+				{
+					GlxAlgorithms::MergeAdjacent(InData + Begin, Width, End - Begin, Buffer + InPair * Width, InLess);
+				}
+			}, ThreadCount);
+		}
+
+		GLX_FREE(Buffer);
+	}
+};
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Utils/BitUtils.h"
+#include "GLX/Utils/NonCopyable.h"
+#include "GLX/Threading/ReadWriteLock.h"
+
+#include "HashMap.h"
+
+template<typename TKey, typename TValue, typename TKeyHasher = GlxHasher<TKey>, typename TBucketPolicy = GlxPowerOfTwoBucketPolicy, GlxInt64 InShardCount = 32>
+class GlxConcurrentHashMap : public GlxNonCopyable
+{
+public:
+	using KeyType = TKey;
+	using ValueType = TValue;
+	using KeyHasherType = TKeyHasher;
+	using BucketPolicyType = TBucketPolicy;
+	using HashCodeType = GlxSizeT;
+
+	using SizeType = GlxInt64;
+	using MapType = GlxHashMap<KeyType, ValueType, KeyHasherType, BucketPolicyType>;
+	using NodeType = typename MapType::NodeType;
+
+	static GLX_CONSTEXPR SizeType ShardCount = InShardCount;
+	static GLX_CONSTEXPR GlxSizeT ShardAlignment = 64;
+
+	static_assert(GlxBitUtils::IsPowerOfTwo(static_cast<GlxUInt64>(InShardCount)), "Shard count must be a power of two");
+
+private:
+	class alignas(ShardAlignment) GlxShard
+	{
+	public:
+		mutable GlxReadWriteLock Lock;
+		MapType Map;
+	};
+
+	// The shard is picked from the low bits of a remixed hash. The bucket policies inside a shard index by the top bits of
+	// their own multiply, so the two choices stay independent.
+	static GLX_FORCE_INLINE SizeType GetShardIndex(HashCodeType InHash)
+	{
+		GlxUInt64 Hash = static_cast<GlxUInt64>(InHash);
+		Hash ^= Hash >> 33;
+		Hash *= 0xFF51AFD7ED558CCDULL;
+		Hash ^= Hash >> 33;
+		return static_cast<SizeType>(Hash & static_cast<GlxUInt64>(ShardCount - 1));
+	}
+
+	GLX_FORCE_INLINE GlxShard& GetShard(HashCodeType InHash)
+	{
+		return Shards[GetShardIndex(InHash)];
+	}
+
+	GLX_FORCE_INLINE const GlxShard& GetShard(HashCodeType InHash) const
+	{
+		return Shards[GetShardIndex(InHash)];
+	}
+
+public:
+	GlxConcurrentHashMap() = default;
+	~GlxConcurrentHashMap() = default;
+
+	explicit GlxConcurrentHashMap(SizeType InExpectedElementCount)
+	{
+		Reserve(InExpectedElementCount);
+	}
+
+	void Reserve(SizeType InExpectedElementCount)
+	{
+		const SizeType PerShard = InExpectedElementCount / ShardCount + 1;
+		const SizeType NumList = static_cast<SizeType>(static_cast<GlxFloat>(PerShard) / MapType::GetMaxLoadFactor()) + 1;
+
+		for (SizeType Index = 0; Index < ShardCount; ++Index)
+		{
+			GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shards[Index].Lock);
+			Shards[Index].Map.Rehash(NumList);
+		}
+	}
+
+	void Clear()
+	{
+		for (SizeType Index = 0; Index < ShardCount; ++Index)
+		{
+			GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shards[Index].Lock);
+			Shards[Index].Map.Clear();
+		}
+	}
+
+	// Not a snapshot: shards are summed one at a time while writers may still be running.
+	SizeType GetElementCount() const
+	{
+		SizeType Count = 0;
+
+		for (SizeType Index = 0; Index < ShardCount; ++Index)
+		{
+			GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Shards[Index].Lock);
+			Count += Shards[Index].Map.GetElementCount();
+		}
+
+		return Count;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsEmpty() const
+	{
+		return GetElementCount() == 0;
+	}
+
+	GlxBool Contains(const KeyType& InKey) const
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		const GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		return Shard.Map.ContainsByHash(HashCode);
+	}
+
+	GlxBool Find(const KeyType& InKey, ValueType& OutValue) const
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		const GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		const NodeType* Node = Shard.Map.FindByHash(HashCode);
+
+		if (!Node)
+		{
+			return false;
+		}
+
+		OutValue = Node->Element.Value;
+		return true;
+	}
+
+	// Runs InFunc(const ValueType&) under the shard's read lock.
+	template<typename TFunc>
+	GlxBool FindAndVisit(const KeyType& InKey, TFunc InFunc) const
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		const GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		const NodeType* Node = Shard.Map.FindByHash(HashCode);
+
+		if (!Node)
+		{
+			return false;
+		}
+
+		InFunc(Node->Element.Value);
+		return true;
+	}
+
+	// Runs InFunc(ValueType&) under the shard's write lock, so read-modify-write updates are atomic.
+	template<typename TFunc>
+	GlxBool FindAndApply(const KeyType& InKey, TFunc InFunc)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		NodeType* Node = Shard.Map.FindByHash(HashCode);
+
+		if (!Node)
+		{
+			return false;
+		}
+
+		InFunc(Node->Element.Value);
+		return true;
+	}
+
+	// Returns true if the element was inserted, false if the key already existed (the value is left untouched).
+	template<typename... TArgs>
+	GlxBool Emplace(const KeyType& InKey, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		return Shard.Map.EmplaceByHash(HashCode, InKey, Forward<TArgs>(InArgs)...) != nullptr;
+	}
+
+	template<typename... TArgs>
+	GlxBool Emplace(KeyType&& InKey, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		return Shard.Map.EmplaceByHash(HashCode, Move(InKey), Forward<TArgs>(InArgs)...) != nullptr;
+	}
+
+	// Returns true if the element was inserted, false if an existing value was assigned.
+	template<typename... TArgs>
+	GlxBool EmplaceOrAssign(const KeyType& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceOrAssignImpl<const KeyType&>(InKey, Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GlxBool EmplaceOrAssign(KeyType&& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceOrAssignImpl<KeyType&&>(Move(InKey), Forward<TArgs>(InArgs)...);
+	}
+
+	// Applies InFunc(ValueType&) to the existing value, or inserts ValueType(InArgs...) when the key is missing.
+	// Returns true if the element was inserted.
+	template<typename TFunc, typename... TArgs>
+	GlxBool EmplaceOrApply(const KeyType& InKey, TFunc InFunc, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		NodeType* Node = Shard.Map.FindByHash(HashCode);
+
+		if (Node)
+		{
+			InFunc(Node->Element.Value);
+			return false;
+		}
+
+		Shard.Map.EmplaceByHash(HashCode, InKey, Forward<TArgs>(InArgs)...);
+		return true;
+	}
+
+	GlxBool Remove(const KeyType& InKey)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		const SizeType OldCount = Shard.Map.GetElementCount();
+		Shard.Map.RemoveByHash(HashCode);
+		return Shard.Map.GetElementCount() != OldCount;
+	}
+
+	// Visits every element shard by shard; each shard is read-locked only while it is being visited.
+	template<typename TFunc>
+	void ForEach(TFunc InFunc) const
+	{
+		for (SizeType Index = 0; Index < ShardCount; ++Index)
+		{
+			GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Shards[Index].Lock);
+
+			for (const auto& Element : Shards[Index].Map)
+			{
+				InFunc(Element.Key, Element.Value);
+			}
+		}
+	}
+
+private:
+	template<typename K, typename... TArgs>
+	GlxBool EmplaceOrAssignImpl(K InKey, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		GlxShard& Shard = GetShard(HashCode);
+
+		GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Shard.Lock);
+		NodeType* Node = Shard.Map.FindByHash(HashCode);
+
+		if (Node)
+		{
+			Node->Element.Value = ValueType(Forward<TArgs>(InArgs)...);
+			return false;
+		}
+
+		if constexpr (GlxIsRvalueReference<K>::Value)
+		{
+			Shard.Map.EmplaceByHash(HashCode, Move(InKey), Forward<TArgs>(InArgs)...);
+		}
+		else
+		{
+			Shard.Map.EmplaceByHash(HashCode, InKey, Forward<TArgs>(InArgs)...);
+		}
+
+		return true;
+	}
+
+	GlxShard Shards[InShardCount];
+};
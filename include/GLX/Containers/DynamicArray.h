@@ -1,6 +1,7 @@
 #pragma once
 
 #include "GLX/Assert.h"
+#include "GLX/Memory/Allocators.h"
 #include "GLX/Memory/MemoryUtils.h"
 #include "GLX/TypeTraits/TypeChooser.h"
 #include "GLX/TypeTraits/IsMoveAssignable.h"
@@ -8,11 +9,12 @@
 
 #include <initializer_list>
 
-template<typename T>
+template<typename T, typename TAllocator = GlxHeapAllocator>
 class GlxDynamicArray
 {
 public:
 	using SizeType = GlxInt64;
+	using AllocatorType = TAllocator;
 
 	using ElementType = T;
 	using ReferenceType = T&;
@@ -25,11 +27,33 @@ public:
 
 	static GLX_CONSTEXPR SizeType InvalidIndex = GLX_INVALID_INDEX;
 	static GLX_CONSTEXPR GlxFloat GrowthFactor = 2.0f;
+	static GLX_CONSTEXPR SizeType InlineCapacity = static_cast<SizeType>(AllocatorType::InlineBytes / sizeof(T));
 
 private:
+	static GLX_FORCE_INLINE SizeType GetAllocationCapacity(SizeType InCapacity)
+	{
+		return InCapacity < InlineCapacity ? InlineCapacity : InCapacity;
+	}
+
+	// Allocators with inline storage hand it out up front, so small arrays never reach the heap.
+	GLX_FORCE_INLINE void ResetStorage()
+	{
+		if constexpr (InlineCapacity > 0)
+		{
+			Data = static_cast<PointerType>(Allocator.Allocate(InlineCapacity * sizeof(ElementType)));
+			Capacity = InlineCapacity;
+		}
+		else
+		{
+			Data = nullptr;
+			Capacity = 0;
+		}
+	}
+
 	void Initialize(SizeType InElementCount, ConstPointerType InElements)
 	{
-		Data = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+		Capacity = GetAllocationCapacity(Capacity);
+		Data = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 		if (InElementCount > 0 && InElements)
 		{
@@ -50,7 +74,18 @@ private:
 	template<GlxBool InUseMove>
 	void Reallocate(SizeType InNewCap, typename GlxTypeChooser<InUseMove, PointerType, ConstPointerType>::Type InElements, SizeType InElementCount)
 	{
-		PointerType NewData = static_cast<PointerType>(GLX_MALLOC(InNewCap * sizeof(ElementType)));
+		InNewCap = GetAllocationCapacity(InNewCap);
+
+		if constexpr (InUseMove && GlxIsBitwiseRelocatable<ElementType>::Value)
+		{
+			if (InElements == Data)
+			{
+				RelocateStorage(InNewCap);
+				return;
+			}
+		}
+
+		PointerType NewData = static_cast<PointerType>(Allocator.Allocate(InNewCap * sizeof(ElementType)));
 
 		if (InElementCount > 0 && InElements)
 		{
@@ -82,15 +117,88 @@ private:
 			}
 		}
 
-		GLX_FREE(Data);
+		Allocator.Free(Data);
 		Data = NewData;
 		Capacity = InNewCap;
 	}
 
+	// Only valid for GlxIsBitwiseRelocatable elements: the allocator may grow the block in place and skip the copy.
+	GLX_FORCE_INLINE void RelocateStorage(SizeType InNewCap)
+	{
+		Data = static_cast<PointerType>(Allocator.Reallocate(Data, Capacity * sizeof(ElementType), InNewCap * sizeof(ElementType)));
+		Capacity = InNewCap;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsInStorage(ConstPointerType InPtr) const
+	{
+		return InPtr >= Data && InPtr < Data + Capacity;
+	}
+
+	// Moves InCount elements from InSource down to InDest (InDest <= InSource); the ranges may overlap.
+	GLX_FORCE_INLINE void ShiftDown(SizeType InDest, SizeType InSource, SizeType InCount)
+	{
+		if (InDest == InSource || InCount <= 0)
+		{
+			return;
+		}
+
+		if constexpr (GlxIsMemcpyCompatible<ElementType>::Value)
+		{
+			GLX_MEMMOVE(Data + InDest, Data + InSource, InCount * sizeof(ElementType));
+		}
+		else
+		{
+			for (SizeType Idx = 0; Idx < InCount; ++Idx)
+			{
+				Data[InDest + Idx] = Move(Data[InSource + Idx]);
+			}
+		}
+	}
+
+	// Destroys the elements past InNewLength and returns how many were removed.
+	GLX_FORCE_INLINE SizeType TruncateTo(SizeType InNewLength)
+	{
+		const SizeType RemovedCount = Length - InNewLength;
+		GlxMemoryUtils::DestructElements<ElementType, SizeType>(Data + InNewLength, RemovedCount);
+		Length = InNewLength;
+		return RemovedCount;
+	}
+
+	// The source keeps its storage (e.g. an inline buffer), so its elements are moved into a fresh block of ours.
+	void MoveFromNonTransferable(GlxDynamicArray& InOther)
+	{
+		Capacity = GetAllocationCapacity(Capacity);
+		Data = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
+
+		if constexpr (GlxIsBitwiseRelocatable<ElementType>::Value)
+		{
+			// Bitwise relocation: the source elements are not destroyed, their bytes now live in Data.
+			if (Length > 0)
+			{
+				GLX_MEMCPY(Data, InOther.Data, Length * sizeof(ElementType));
+			}
+		}
+		else
+		{
+			GlxMemoryUtils::MoveConstructElements<ElementType, SizeType>(Data, InOther.Data, Length);
+			GlxMemoryUtils::DestructElements<ElementType, SizeType>(InOther.Data, InOther.Length);
+		}
+
+		InOther.Length = 0;
+	}
+
 public:
 	GlxDynamicArray()
 		: Data(nullptr), Length(0), Capacity(0)
-	{}
+	{
+		ResetStorage();
+	}
+
+	explicit GlxDynamicArray(const AllocatorType& InAllocator)
+		: Data(nullptr), Length(0), Capacity(0), Allocator(InAllocator)
+	{
+		ResetStorage();
+	}
 
 	GlxDynamicArray(ConstPointerType InElements, SizeType InElementCount)
 	{
@@ -115,17 +223,23 @@ public:
 	}
 
 	GlxDynamicArray(const GlxDynamicArray& InOther)
-		: Length(InOther.Length), Capacity(InOther.Capacity)
+		: Length(InOther.Length), Capacity(InOther.Capacity), Allocator(InOther.Allocator)
 	{
 		Initialize(InOther.Length, InOther.Data);
 	}
 
 	GlxDynamicArray(GlxDynamicArray&& InOther) noexcept
-		: Data(InOther.Data), Length(InOther.Length), Capacity(InOther.Capacity)
+		: Data(InOther.Data), Length(InOther.Length), Capacity(InOther.Capacity), Allocator(InOther.Allocator)
 	{
-		InOther.Data = nullptr;
-		InOther.Length = 0;
-		InOther.Capacity = 0;
+		if (InOther.Allocator.CanTransferAllocation(InOther.Data))
+		{
+			InOther.Length = 0;
+			InOther.ResetStorage();
+		}
+		else
+		{
+			MoveFromNonTransferable(InOther);
+		}
 	}
 
 	GlxDynamicArray(const GlxDynamicArray& InArray, SizeType InStartPos, SizeType InElementCount)
@@ -140,8 +254,16 @@ public:
 		: Length(0)
 	{
 		GLX_ASSERT(InInitialCapacity >= 0);
-		Capacity = InInitialCapacity;
-		Data = static_cast<PointerType>(GLX_MALLOC(InInitialCapacity * sizeof(ElementType)));
+		Capacity = GetAllocationCapacity(InInitialCapacity);
+		Data = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
+	}
+
+	GlxDynamicArray(SizeType InInitialCapacity, const AllocatorType& InAllocator)
+		: Length(0), Allocator(InAllocator)
+	{
+		GLX_ASSERT(InInitialCapacity >= 0);
+		Capacity = GetAllocationCapacity(InInitialCapacity);
+		Data = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 	}
 
 	GlxDynamicArray(ConstIteratorType InStart, ConstIteratorType InEnd)
@@ -170,7 +292,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = nullptr;
 			Length = 0;
 			Capacity = 0;
@@ -192,6 +314,11 @@ public:
 		return Capacity - Length;
 	}
 
+	GLX_FORCE_INLINE const AllocatorType& GetAllocator() const
+	{
+		return Allocator;
+	}
+
 	GLX_FORCE_INLINE PointerType GetData()
 	{
 		return Data;
@@ -365,14 +492,24 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
-			Data = InOther.Data;
-			Length = InOther.Length;
-			Capacity = InOther.Capacity;
+			Allocator.Free(Data);
+			Allocator = InOther.Allocator;
 
-			InOther.Data = nullptr;
-			InOther.Length = 0;
-			InOther.Capacity = 0;
+			if (InOther.Allocator.CanTransferAllocation(InOther.Data))
+			{
+				Data = InOther.Data;
+				Length = InOther.Length;
+				Capacity = InOther.Capacity;
+
+				InOther.Length = 0;
+				InOther.ResetStorage();
+			}
+			else
+			{
+				Length = InOther.Length;
+				Capacity = InOther.Capacity;
+				MoveFromNonTransferable(InOther);
+			}
 		}
 
 		return *this;
@@ -400,7 +537,7 @@ public:
 
 	GLX_FORCE_INLINE void Shrink()
 	{
-		if (Capacity != Length)
+		if (Capacity != GetAllocationCapacity(Length))
 		{
 			Reallocate<true>(Length, Data, Length);
 		}
@@ -447,6 +584,52 @@ public:
 		Length = InNewLength;
 	}
 
+	// The new elements are left uninitialized, so it is only available for trivial element types.
+	void ResizeUninitialized(SizeType InNewLength)
+	{
+		static_assert(GlxIsTrivial<ElementType>::Value, "ResizeUninitialized requires a trivial element type");
+		GLX_ASSERT(InNewLength >= 0);
+
+		if (InNewLength > Capacity)
+		{
+			Reallocate<true>(InNewLength, Data, Length);
+		}
+
+		Length = InNewLength;
+	}
+
+	SizeType AddUninitialized(SizeType InCount = 1)
+	{
+		static_assert(GlxIsTrivial<ElementType>::Value, "AddUninitialized requires a trivial element type");
+		GLX_ASSERT(InCount >= 0);
+
+		GetWritableSpan(InCount);
+
+		SizeType Index = Length;
+		Length += InCount;
+		return Index;
+	}
+
+	// Makes room for InCount elements past the end and returns a pointer to them without touching the memory or the
+	// element count. Fill (or placement-new) a prefix of the span, then publish it with CommitWritableSpan.
+	PointerType GetWritableSpan(SizeType InCount)
+	{
+		GLX_ASSERT(InCount >= 0);
+
+		if (Length + InCount > Capacity)
+		{
+			Reallocate<true>(static_cast<SizeType>(Capacity * GrowthFactor + InCount), Data, Length);
+		}
+
+		return Data + Length;
+	}
+
+	GLX_FORCE_INLINE void CommitWritableSpan(SizeType InCount)
+	{
+		GLX_ASSERT(InCount >= 0 && Length + InCount <= Capacity);
+		Length += InCount;
+	}
+
 	GLX_NODISCARD SizeType Find(ConstReferenceType InItem) const
 	{
 		for (const ElementType* Start = Data, *End = Data + Length; Start != End; ++Start)
@@ -574,10 +757,25 @@ public:
 	template<typename... TArgs>
 	void EmplaceBack(TArgs&&... InArgs)
 	{
+		if constexpr (GlxIsBitwiseRelocatable<ElementType>::Value)
+		{
+			if (Length >= Capacity)
+			{
+				// Built before the block moves, since InArgs may reference an element of this array.
+				alignas(ElementType) GlxUInt8 Storage[sizeof(ElementType)];
+				new (Storage) ElementType(Forward<TArgs>(InArgs)...);
+
+				RelocateStorage(GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + 1)));
+				GLX_MEMCPY(static_cast<void*>(Data + Length), Storage, sizeof(ElementType));
+				++Length;
+				return;
+			}
+		}
+
 		if (Length >= Capacity)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + 1);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + 1));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			new (NewData + Length) ElementType(Forward<TArgs>(InArgs)...);
 
@@ -608,7 +806,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 		else
@@ -629,10 +827,18 @@ public:
 	{
 		GLX_ASSERT(InCount >= 0);
 
-		if (Length + InCount >= Capacity)
+		if constexpr (GlxIsBitwiseRelocatable<ElementType>::Value)
+		{
+			if (Length + InCount > Capacity)
+			{
+				RelocateStorage(GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount)));
+			}
+		}
+
+		if (Length + InCount > Capacity)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			if constexpr (GlxIsMemcpyCompatible<ElementType>::Value)
 			{
@@ -661,7 +867,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 
@@ -732,7 +938,7 @@ public:
 
 		if constexpr (GlxIsMemcpyCompatible<ElementType>::Value)
 		{
-			GLX_MEMCPY(Dest, Dest + InCount, (Length - InIndex) * sizeof(ElementType));
+			GLX_MEMMOVE(Dest, Dest + InCount, (Length - InIndex) * sizeof(ElementType));
 		}
 		else
 		{
@@ -787,20 +993,14 @@ public:
 		return RemoveAt(Index);
 	}
 
-	void RemoveAll(ConstReferenceType InItem)
+	SizeType RemoveAll(ConstReferenceType InItem)
 	{
-		for (SizeType Idx = Length - 1; Idx >= 0; --Idx)
-		{
-			if (Data[Idx] == InItem)
-			{
-				RemoveAt(Idx);
+		return RemoveAllIf([&InItem](ConstReferenceType InElement) { return InElement == InItem; });
+	}
 
-				if (Length == 0)
-				{
-					break;
-				}
-			}
-		}
+	SizeType RemoveAllSwap(ConstReferenceType InItem)
+	{
+		return RemoveAllSwapIf([&InItem](ConstReferenceType InElement) { return InElement == InItem; });
 	}
 
 	template<typename TPredicate>
@@ -829,21 +1029,96 @@ public:
 		return RemoveAt(Index);
 	}
 
+	// Stable single-pass compaction: every surviving element is moved at most once, and each run of survivors between
+	// two removed elements is shifted as one block (a single memmove for memcpy-compatible types).
+	// Returns the number of removed elements.
+	template<typename TPredicate>
+	SizeType RemoveAllIf(TPredicate InPred)
+	{
+		SizeType Write = 0;
+
+		while (Write < Length && !InPred(Data[Write]))
+		{
+			++Write;
+		}
+
+		SizeType Read = Write + 1;
+
+		while (Read < Length)
+		{
+			const SizeType RunStart = Read;
+
+			while (Read < Length && !InPred(Data[Read]))
+			{
+				++Read;
+			}
+
+			ShiftDown(Write, RunStart, Read - RunStart);
+			Write += Read - RunStart;
+			++Read;
+		}
+
+		return Write < Length ? TruncateTo(Write) : 0;
+	}
+
+	// Removed elements are replaced by elements taken from the end, so the order is not preserved but each survivor
+	// is moved at most once and only the removed slots are written. Returns the number of removed elements.
 	template<typename TPredicate>
-	void RemoveAllIf(TPredicate InPred)
+	SizeType RemoveAllSwapIf(TPredicate InPred)
 	{
-		for (SizeType Idx = Length - 1; Idx >= 0; --Idx)
+		SizeType NewLength = Length;
+
+		for (SizeType Idx = 0; Idx < NewLength;)
 		{
 			if (InPred(Data[Idx]))
 			{
-				RemoveAt(Idx);
+				--NewLength;
 
-				if (Length == 0)
+				if (Idx != NewLength)
 				{
-					break;
+					Data[Idx] = Move(Data[NewLength]);
 				}
 			}
+			else
+			{
+				++Idx;
+			}
 		}
+
+		return NewLength < Length ? TruncateTo(NewLength) : 0;
+	}
+
+	// Removes the elements at InIndices, which must be sorted in ascending order and free of duplicates. The survivors
+	// between two consecutive indices are shifted as one block. Returns the number of removed elements.
+	SizeType RemoveIndices(SizeType InCount, const SizeType* InIndices)
+	{
+		GLX_ASSERT(InCount >= 0 && InCount <= Length);
+
+		if (InCount == 0)
+		{
+			return 0;
+		}
+
+		SizeType Write = InIndices[0];
+
+		for (SizeType Idx = 0; Idx < InCount; ++Idx)
+		{
+			const SizeType RunStart = InIndices[Idx] + 1;
+			const SizeType RunEnd = Idx + 1 < InCount ? InIndices[Idx + 1] : Length;
+
+			GLX_ASSERT(InIndices[Idx] >= 0 && RunStart <= RunEnd && RunEnd <= Length);
+
+			ShiftDown(Write, RunStart, RunEnd - RunStart);
+			Write += RunEnd - RunStart;
+		}
+
+		return TruncateTo(Write);
+	}
+
+	template<typename TOtherAllocator>
+	GLX_FORCE_INLINE SizeType RemoveIndices(const GlxDynamicArray<SizeType, TOtherAllocator>& InIndices)
+	{
+		return RemoveIndices(InIndices.GetElementCount(), InIndices.GetData());
 	}
 
 	ElementType Pop()
@@ -857,10 +1132,18 @@ public:
 	{
 		GLX_ASSERT(InCount >= 0);
 
-		if (Length + InCount >= Capacity)
+		if constexpr (GlxIsBitwiseRelocatable<ElementType>::Value)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			if (Length + InCount > Capacity && !IsInStorage(InElements))
+			{
+				RelocateStorage(GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount)));
+			}
+		}
+
+		if (Length + InCount > Capacity)
+		{
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			if constexpr (GlxIsMemcpyCompatible<ElementType>::Value)
 			{
@@ -897,7 +1180,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 		else
@@ -924,10 +1207,18 @@ public:
 	{
 		GLX_ASSERT(InCount >= 0);
 
-		if (Length + InCount >= Capacity)
+		if constexpr (GlxIsBitwiseRelocatable<ElementType>::Value)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			if (Length + InCount > Capacity && !IsInStorage(&InItem))
+			{
+				RelocateStorage(GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount)));
+			}
+		}
+
+		if (Length + InCount > Capacity)
+		{
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			PointerType Dest = NewData + Length;
 			for (SizeType Idx = 0; Idx < InCount; ++Idx)
@@ -962,7 +1253,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 		else
@@ -1017,8 +1308,8 @@ public:
 
 		if (Length == Capacity)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + 1);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + 1));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			new (NewData + InIndex) ElementType(Forward<TArgs>(InArgs)...);
 
@@ -1072,7 +1363,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 		else
@@ -1147,8 +1438,8 @@ public:
 
 		if (Length + InCount >= Capacity)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC(Capacity * sizeof(ElementType)));
+			Capacity = GetAllocationCapacity(static_cast<SizeType>(Capacity * GrowthFactor + InCount));
+			PointerType NewData = static_cast<PointerType>(Allocator.Allocate(Capacity * sizeof(ElementType)));
 
 			if constexpr (GlxIsMemcpyCompatible<ElementType>::Value)
 			{
@@ -1207,7 +1498,7 @@ public:
 				}
 			}
 
-			GLX_FREE(Data);
+			Allocator.Free(Data);
 			Data = NewData;
 		}
 		else
@@ -1367,4 +1658,13 @@ private:
 	PointerType Data;
 	SizeType Length;
 	SizeType Capacity;
+	GLX_NO_UNIQUE_ADDRESS AllocatorType Allocator;
 };
+
+template<typename T>
+class GlxIsBitwiseRelocatable<GlxDynamicArray<T, GlxHeapAllocator>> : public GlxTrueType
+{};
+
+template<typename T, GlxSizeT InAlignment>
+class GlxIsBitwiseRelocatable<GlxDynamicArray<T, GlxAlignedAllocator<InAlignment>>> : public GlxTrueType
+{};
@@ -0,0 +1,1132 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Types/Pair.h"
+#include "GLX/Utils/BitUtils.h"
+#include "GLX/Utils/HashFunctions.h"
+#include "GLX/Memory/MemoryUtils.h"
+#include "GLX/TypeTraits/TypeChooser.h"
+#include "GLX/TypeTraits/RemoveReference.h"
+#include "GLX/TypeTraits/IsRvalueReference.h"
+
+#include "DynamicArray.h"
+
+#include <initializer_list>
+
+#if defined(GLX_SIMD_SSE2)
+	#include <emmintrin.h>
+#endif
+
+// Open-addressing hash map in the style of Swiss tables.
+// Every slot has one control byte: Empty, Deleted or the low 7 bits (H2) of the hash of a full slot.
+// Lookups load a whole group of control bytes and compare H2 against all of them at once, so most probes touch a single cache line.
+// Erasing a slot only leaves a tombstone when a probe sequence could have passed over it (the slot sits inside a group that has been full).
+namespace GlxNsPrivate
+{
+	using GlxFlatCtrl = GlxInt8;
+
+	static GLX_CONSTEXPR GlxFlatCtrl FlatCtrlEmpty = -128;
+	static GLX_CONSTEXPR GlxFlatCtrl FlatCtrlDeleted = -2;
+
+	template<typename TMask, GlxInt32 InSignificantBits, GlxInt32 InShift>
+	class GlxFlatBitMask
+	{
+	public:
+		GLX_FORCE_INLINE explicit GlxFlatBitMask(TMask InMask)
+			: Mask(InMask)
+		{}
+
+		GLX_FORCE_INLINE explicit operator bool() const
+		{
+			return Mask != 0;
+		}
+
+		GLX_FORCE_INLINE GlxUInt32 GetLowestBitIndex() const
+		{
+			return GlxBitUtils::CountTrailingZeros(Mask) >> InShift;
+		}
+
+		GLX_FORCE_INLINE void ClearLowestBit()
+		{
+			Mask &= (Mask - 1);
+		}
+
+		GLX_FORCE_INLINE GlxUInt32 CountTrailingZeros() const
+		{
+			return GlxBitUtils::CountTrailingZeros(Mask) >> InShift;
+		}
+
+		GLX_FORCE_INLINE GlxUInt32 CountLeadingZeros() const
+		{
+			static GLX_CONSTEXPR GlxUInt32 ExtraBits = sizeof(TMask) * 8 - (InSignificantBits << InShift);
+			return (GlxBitUtils::CountLeadingZeros(Mask) - ExtraBits) >> InShift;
+		}
+
+	private:
+		TMask Mask;
+	};
+
+#if defined(GLX_SIMD_SSE2)
+	class GlxFlatGroup
+	{
+	public:
+		using BitMaskType = GlxFlatBitMask<GlxUInt32, 16, 0>;
+
+		static GLX_CONSTEXPR GlxInt64 Width = 16;
+
+		GLX_FORCE_INLINE explicit GlxFlatGroup(const GlxFlatCtrl* InCtrl)
+			: Ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(InCtrl)))
+		{}
+
+		GLX_FORCE_INLINE BitMaskType Match(GlxFlatCtrl InH2) const
+		{
+			return BitMaskType(static_cast<GlxUInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(InH2), Ctrl))));
+		}
+
+		GLX_FORCE_INLINE BitMaskType MatchEmpty() const
+		{
+			return BitMaskType(static_cast<GlxUInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(FlatCtrlEmpty), Ctrl))));
+		}
+
+		GLX_FORCE_INLINE BitMaskType MatchEmptyOrDeleted() const
+		{
+			return BitMaskType(static_cast<GlxUInt32>(_mm_movemask_epi8(Ctrl)));
+		}
+
+	private:
+		__m128i Ctrl;
+	};
+#else
+	// Portable fallback: 8 control bytes per group, matched with SWAR tricks on a 64-bit word (little-endian).
+	// Match() may report false positives next to a real match; callers always confirm with the key.
+	class GlxFlatGroup
+	{
+	public:
+		using BitMaskType = GlxFlatBitMask<GlxUInt64, 8, 3>;
+
+		static GLX_CONSTEXPR GlxInt64 Width = 8;
+
+		static GLX_CONSTEXPR GlxUInt64 Lsbs = 0x0101010101010101ULL;
+		static GLX_CONSTEXPR GlxUInt64 Msbs = 0x8080808080808080ULL;
+
+		GLX_FORCE_INLINE explicit GlxFlatGroup(const GlxFlatCtrl* InCtrl)
+		{
+			GLX_MEMCPY(&Ctrl, InCtrl, sizeof(Ctrl));
+		}
+
+		GLX_FORCE_INLINE BitMaskType Match(GlxFlatCtrl InH2) const
+		{
+			const GlxUInt64 X = Ctrl ^ (Lsbs * static_cast<GlxUInt8>(InH2));
+			return BitMaskType((X - Lsbs) & ~X & Msbs);
+		}
+
+		GLX_FORCE_INLINE BitMaskType MatchEmpty() const
+		{
+			return BitMaskType((Ctrl & ~(Ctrl << 6)) & Msbs);
+		}
+
+		GLX_FORCE_INLINE BitMaskType MatchEmptyOrDeleted() const
+		{
+			return BitMaskType(Ctrl & Msbs);
+		}
+
+	private:
+		GlxUInt64 Ctrl;
+	};
+#endif
+}
+
+template<typename TKey, typename TValue, typename TKeyHasher = GlxHasher<TKey>>
+class GlxFlatHashMap
+{
+public:
+	using KeyType = TKey;
+	using ValueType = TValue;
+	using KeyHasherType = TKeyHasher;
+	using HashCodeType = GlxSizeT;
+
+	using SizeType = GlxInt64;
+	using PairType = GlxPair<KeyType, ValueType>;
+
+	using CtrlType = GlxNsPrivate::GlxFlatCtrl;
+	using GroupType = GlxNsPrivate::GlxFlatGroup;
+
+	class GlxElement
+	{
+	public:
+		friend class GlxFlatHashMap<TKey, TValue, TKeyHasher>;
+
+		using HashCodeType = GlxSizeT;
+
+		template<typename K, typename... TArgs>
+		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, K&& InKey, TArgs&&... InArgs)
+			: Key(Forward<K>(InKey)), Value(Forward<TArgs>(InArgs)...), HashCode(InHash)
+		{}
+
+		GlxElement(const GlxElement&) = default;
+		GlxElement(GlxElement&&) noexcept = default;
+		GlxElement& operator=(const GlxElement&) = default;
+		GlxElement& operator=(GlxElement&&) noexcept = default;
+
+		GLX_FORCE_INLINE HashCodeType GetHashCode() const
+		{
+			return HashCode;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator==(const GlxElement& InOther) const
+		{
+			return Key == InOther.Key && Value == InOther.Value && HashCode == InOther.HashCode;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator!=(const GlxElement& InOther) const
+		{
+			return !operator==(InOther);
+		}
+
+		KeyType Key;
+		ValueType Value;
+
+	private:
+		HashCodeType HashCode;
+	};
+
+	using ElementType = GlxElement;
+	using PointerType = ElementType*;
+	using ReferenceType = ElementType&;
+	using ConstPointerType = const ElementType*;
+	using ConstReferenceType = const ElementType&;
+
+	// Same shape as GlxHashMap::GlxNode (Node->Element.Key / Node->Element.Value), so both maps can be swapped with a typedef.
+	class GlxSlot
+	{
+	public:
+		ElementType Element;
+	};
+
+	using NodeType = GlxSlot;
+
+	static GLX_CONSTEXPR SizeType GroupWidth = GroupType::Width;
+	static GLX_CONSTEXPR SizeType MinCapacity = GroupWidth;
+
+	static GLX_FORCE_INLINE HashCodeType GetHashCode(const KeyType& InKey)
+	{
+		return KeyHasherType::GetHashCode(InKey);
+	}
+
+	static GLX_CONSTEXPR GLX_FORCE_INLINE GlxFloat GetMaxLoadFactor()
+	{
+		return 0.875f;
+	}
+
+public:
+	template<GlxBool InIsConst>
+	class GlxIteratorBase
+	{
+	public:
+		friend class GlxFlatHashMap<KeyType, ValueType, KeyHasherType>;
+
+		using HashMapType = typename GlxTypeChooser<InIsConst, const GlxFlatHashMap, GlxFlatHashMap>::Type;
+
+		GLX_FORCE_INLINE GlxIteratorBase(HashMapType* InMap, SizeType InIndex)
+			: Map(InMap), Index(InIndex)
+		{
+			SetIteratorToValidSlot();
+		}
+
+		GlxIteratorBase(const GlxIteratorBase&) = default;
+		GlxIteratorBase(GlxIteratorBase&&) noexcept = default;
+		GlxIteratorBase& operator=(const GlxIteratorBase&) = default;
+		GlxIteratorBase& operator=(GlxIteratorBase&&) noexcept = default;
+		~GlxIteratorBase() = default;
+
+		GLX_FORCE_INLINE ConstReferenceType operator*() const
+		{
+			return Map->Slots[Index].Element;
+		}
+
+		GLX_FORCE_INLINE ConstPointerType operator->() const
+		{
+			return &Map->Slots[Index].Element;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator==(const GlxIteratorBase& InIt) const
+		{
+			return Map == InIt.Map && Index == InIt.Index;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator!=(const GlxIteratorBase& InIt) const
+		{
+			return Map != InIt.Map || Index != InIt.Index;
+		}
+
+		GLX_FORCE_INLINE GlxIteratorBase& operator++()
+		{
+			++Index;
+			SetIteratorToValidSlot();
+			return *this;
+		}
+
+		GLX_FORCE_INLINE GlxIteratorBase operator++(int)
+		{
+			GlxIteratorBase It(*this);
+			this->operator++();
+			return It;
+		}
+
+		GLX_FORCE_INLINE HashCodeType GetHashCode() const
+		{
+			return Map->Slots[Index].Element.GetHashCode();
+		}
+
+		GLX_FORCE_INLINE const KeyType& GetKey() const
+		{
+			return Map->Slots[Index].Element.Key;
+		}
+
+		GLX_FORCE_INLINE const ValueType& GetValue() const
+		{
+			return Map->Slots[Index].Element.Value;
+		}
+
+	protected:
+		GLX_FORCE_INLINE void SetIteratorToValidSlot()
+		{
+			while (Index < Map->Capacity && Map->Ctrl[Index] < 0)
+			{
+				++Index;
+			}
+		}
+
+		HashMapType* Map;
+		SizeType Index;
+	};
+
+	template<GlxBool InIsConst>
+	friend class GlxIteratorBase;
+
+	class GlxIterator : public GlxIteratorBase<false>
+	{
+	public:
+		using Super = GlxIteratorBase<false>;
+
+		GLX_FORCE_INLINE GlxIterator(GlxFlatHashMap* InMap, SizeType InIndex)
+			: Super(InMap, InIndex)
+		{}
+
+		GLX_FORCE_INLINE ReferenceType operator*()
+		{
+			return this->Map->Slots[this->Index].Element;
+		}
+
+		GLX_FORCE_INLINE PointerType operator->()
+		{
+			return &this->Map->Slots[this->Index].Element;
+		}
+
+		GLX_FORCE_INLINE KeyType& GetKey()
+		{
+			return this->Map->Slots[this->Index].Element.Key;
+		}
+
+		GLX_FORCE_INLINE ValueType& GetValue()
+		{
+			return this->Map->Slots[this->Index].Element.Value;
+		}
+	};
+
+	class GlxConstIterator : public GlxIteratorBase<true>
+	{
+	public:
+		using Super = GlxIteratorBase<true>;
+
+		GLX_FORCE_INLINE GlxConstIterator(const GlxFlatHashMap* InMap, SizeType InIndex)
+			: Super(InMap, InIndex)
+		{}
+	};
+
+	using IteratorType = GlxIterator;
+	using ConstIteratorType = GlxConstIterator;
+
+	GlxFlatHashMap()
+		:	Ctrl(nullptr),
+			Slots(nullptr),
+			ElementCount(0),
+			Capacity(0),
+			GrowthLeft(0)
+	{}
+
+	explicit GlxFlatHashMap(SizeType InElementCount)
+		: GlxFlatHashMap()
+	{
+		Reserve(InElementCount);
+	}
+
+	GlxFlatHashMap(std::initializer_list<PairType> InPairs)
+		: GlxFlatHashMap()
+	{
+		InsertInitListImpl<false>(static_cast<SizeType>(InPairs.size()), InPairs.begin(), InPairs.end());
+	}
+
+	GlxFlatHashMap(const GlxFlatHashMap& InOther)
+		: GlxFlatHashMap()
+	{
+		CopyFrom(InOther);
+	}
+
+	GlxFlatHashMap(GlxFlatHashMap&& InOther) noexcept
+		:	Ctrl(InOther.Ctrl),
+			Slots(InOther.Slots),
+			ElementCount(InOther.ElementCount),
+			Capacity(InOther.Capacity),
+			GrowthLeft(InOther.GrowthLeft)
+	{
+		InOther.Ctrl = nullptr;
+		InOther.Slots = nullptr;
+		InOther.ElementCount = 0;
+		InOther.Capacity = 0;
+		InOther.GrowthLeft = 0;
+	}
+
+	~GlxFlatHashMap()
+	{
+		Release();
+	}
+
+	GlxFlatHashMap& operator=(const GlxFlatHashMap& InOther)
+	{
+		if (this != &InOther)
+		{
+			Release();
+			CopyFrom(InOther);
+		}
+
+		return *this;
+	}
+
+	GlxFlatHashMap& operator=(GlxFlatHashMap&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Release();
+
+			Ctrl = InOther.Ctrl;
+			Slots = InOther.Slots;
+			ElementCount = InOther.ElementCount;
+			Capacity = InOther.Capacity;
+			GrowthLeft = InOther.GrowthLeft;
+
+			InOther.Ctrl = nullptr;
+			InOther.Slots = nullptr;
+			InOther.ElementCount = 0;
+			InOther.Capacity = 0;
+			InOther.GrowthLeft = 0;
+		}
+
+		return *this;
+	}
+
+	GlxFlatHashMap& operator=(std::initializer_list<PairType> InPairs)
+	{
+		Clear();
+		InsertInitListImpl<false>(static_cast<SizeType>(InPairs.size()), InPairs.begin(), InPairs.end());
+		return *this;
+	}
+
+	void Clear()
+	{
+		if (Capacity == 0)
+		{
+			return;
+		}
+
+		DestructSlots();
+		GLX_MEMSET(Ctrl, GlxNsPrivate::FlatCtrlEmpty, static_cast<GlxSizeT>(Capacity + GroupWidth));
+
+		ElementCount = 0;
+		GrowthLeft = CapacityToGrowth(Capacity);
+	}
+
+	void Release()
+	{
+		if (Capacity == 0)
+		{
+			return;
+		}
+
+		DestructSlots();
+		GLX_FREE(Ctrl);
+
+		Ctrl = nullptr;
+		Slots = nullptr;
+		ElementCount = 0;
+		Capacity = 0;
+		GrowthLeft = 0;
+	}
+
+	GLX_FORCE_INLINE SizeType GetElementCount() const
+	{
+		return ElementCount;
+	}
+
+	GLX_FORCE_INLINE SizeType GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// GlxHashMap's bucket count; here, the number of slots.
+	GLX_FORCE_INLINE SizeType GetNumList() const
+	{
+		return Capacity;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsEmpty() const
+	{
+		return ElementCount == 0;
+	}
+
+	GLX_FORCE_INLINE GlxFloat GetLoadFactor() const
+	{
+		return Capacity > 0 ? (static_cast<GlxFloat>(ElementCount) / static_cast<GlxFloat>(Capacity)) : -1.0f;
+	}
+
+	GLX_FORCE_INLINE IteratorType begin()
+	{
+		return IteratorType(this, 0);
+	}
+
+	GLX_FORCE_INLINE ConstIteratorType begin() const
+	{
+		return ConstIteratorType(this, 0);
+	}
+
+	GLX_FORCE_INLINE IteratorType end()
+	{
+		return IteratorType(this, Capacity);
+	}
+
+	GLX_FORCE_INLINE ConstIteratorType end() const
+	{
+		return ConstIteratorType(this, Capacity);
+	}
+
+	void Reserve(SizeType InElementCount)
+	{
+		if (InElementCount > CapacityToGrowth(Capacity))
+		{
+			RehashImpl(GrowthToCapacity(InElementCount));
+		}
+	}
+
+	void Rehash(SizeType InNewCapacity)
+	{
+		SizeType NewCapacity = GLX_MAX(InNewCapacity, GrowthToCapacity(ElementCount));
+		NewCapacity = static_cast<SizeType>(GlxBitUtils::RoundUpToPowerOfTwo(static_cast<GlxUInt64>(GLX_MAX(NewCapacity, MinCapacity))));
+
+		if (ElementCount == 0 && InNewCapacity == 0)
+		{
+			Release();
+		}
+		else if (NewCapacity != Capacity)
+		{
+			RehashImpl(NewCapacity);
+		}
+	}
+
+	// Like GlxHashMap::FindByHash, matches on the hash code alone.
+	NodeType* FindByHash(HashCodeType InHash)
+	{
+		const SizeType Index = FindIndexByHash(InHash);
+		return Index != GLX_INVALID_INDEX ? Slots + Index : nullptr;
+	}
+
+	const NodeType* FindByHash(const HashCodeType InHash) const
+	{
+		const SizeType Index = FindIndexByHash(InHash);
+		return Index != GLX_INVALID_INDEX ? Slots + Index : nullptr;
+	}
+
+	GLX_FORCE_INLINE NodeType* Find(const KeyType& InKey)
+	{
+		const SizeType Index = FindIndex(KeyHasherType::GetHashCode(InKey), InKey);
+		return Index != GLX_INVALID_INDEX ? Slots + Index : nullptr;
+	}
+
+	GLX_FORCE_INLINE const NodeType* Find(const KeyType& InKey) const
+	{
+		const SizeType Index = FindIndex(KeyHasherType::GetHashCode(InKey), InKey);
+		return Index != GLX_INVALID_INDEX ? Slots + Index : nullptr;
+	}
+
+	GLX_FORCE_INLINE GlxBool Contains(const KeyType& InKey) const
+	{
+		return FindIndex(KeyHasherType::GetHashCode(InKey), InKey) != GLX_INVALID_INDEX;
+	}
+
+	GLX_FORCE_INLINE GlxBool ContainsByHash(const HashCodeType InHash) const
+	{
+		return FindIndexByHash(InHash) != GLX_INVALID_INDEX;
+	}
+
+	GlxBool operator==(const GlxFlatHashMap& InOther) const
+	{
+		if (ElementCount != InOther.ElementCount)
+		{
+			return false;
+		}
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				const ElementType& Element = Slots[Index].Element;
+				const SizeType FoundIndex = InOther.FindIndex(Element.HashCode, Element.Key);
+
+				if (FoundIndex == GLX_INVALID_INDEX || !(InOther.Slots[FoundIndex].Element.Value == Element.Value))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	GLX_FORCE_INLINE GlxBool operator!=(const GlxFlatHashMap& InOther) const
+	{
+		return !operator==(InOther);
+	}
+
+private:
+	static GLX_FORCE_INLINE GlxSizeT MixHash(HashCodeType InHash)
+	{
+		// Fold the upper bits in before splitting into H1/H2, so weak hashers (e.g. shifted pointers) still spread over the groups.
+		GlxUInt64 Mixed = static_cast<GlxUInt64>(InHash);
+		Mixed ^= Mixed >> 33;
+		Mixed *= 0xFF51AFD7ED558CCDULL;
+		Mixed ^= Mixed >> 33;
+		return static_cast<GlxSizeT>(Mixed);
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetH1(GlxSizeT InMixedHash)
+	{
+		return InMixedHash >> 7;
+	}
+
+	static GLX_FORCE_INLINE CtrlType GetH2(GlxSizeT InMixedHash)
+	{
+		return static_cast<CtrlType>(InMixedHash & 0x7F);
+	}
+
+	static GLX_CONSTEXPR GLX_FORCE_INLINE SizeType CapacityToGrowth(SizeType InCapacity)
+	{
+		return InCapacity - InCapacity / 8;
+	}
+
+	static GLX_FORCE_INLINE SizeType GrowthToCapacity(SizeType InGrowth)
+	{
+		const SizeType NewCapacity = InGrowth + (InGrowth + 6) / 7;
+		return static_cast<SizeType>(GlxBitUtils::RoundUpToPowerOfTwo(static_cast<GlxUInt64>(GLX_MAX(NewCapacity, MinCapacity))));
+	}
+
+	GLX_FORCE_INLINE void SetCtrl(SizeType InIndex, CtrlType InH2)
+	{
+		Ctrl[InIndex] = InH2;
+
+		// The first group is mirrored after the last slot, so a group load starting near the end wraps without a branch.
+		if (InIndex < GroupWidth)
+		{
+			Ctrl[Capacity + InIndex] = InH2;
+		}
+	}
+
+	GLX_FORCE_INLINE SizeType FindIndex(HashCodeType InHash, const KeyType& InKey) const
+	{
+		return FindIndexImpl(InHash, [&InKey](const ElementType& InElement) { return InElement.Key == InKey; });
+	}
+
+	GLX_FORCE_INLINE SizeType FindIndexByHash(HashCodeType InHash) const
+	{
+		return FindIndexImpl(InHash, [](const ElementType&) { return true; });
+	}
+
+	template<typename TPredicate>
+	SizeType FindIndexImpl(HashCodeType InHash, TPredicate InPred) const
+	{
+		if (ElementCount == 0)
+		{
+			return GLX_INVALID_INDEX;
+		}
+
+		const GlxSizeT Mixed = MixHash(InHash);
+		const CtrlType H2 = GetH2(Mixed);
+		const SizeType Mask = Capacity - 1;
+
+		SizeType Pos = static_cast<SizeType>(GetH1(Mixed)) & Mask;
+		SizeType ProbeIndex = 0;
+
+		while (true)
+		{
+			GroupType Group(Ctrl + Pos);
+
+			for (typename GroupType::BitMaskType Match = Group.Match(H2); Match; Match.ClearLowestBit())
+			{
+				const SizeType Index = (Pos + Match.GetLowestBitIndex()) & Mask;
+				const ElementType& Element = Slots[Index].Element;
+
+				if (Element.HashCode == InHash && InPred(Element))
+				{
+					return Index;
+				}
+			}
+
+			if (Group.MatchEmpty())
+			{
+				return GLX_INVALID_INDEX;
+			}
+
+			ProbeIndex += GroupWidth;
+			Pos = (Pos + ProbeIndex) & Mask;
+
+			GLX_ASSERT(ProbeIndex <= Capacity);
+		}
+	}
+
+	SizeType FindFirstNonFull(GlxSizeT InMixedHash) const
+	{
+		const SizeType Mask = Capacity - 1;
+
+		SizeType Pos = static_cast<SizeType>(GetH1(InMixedHash)) & Mask;
+		SizeType ProbeIndex = 0;
+
+		while (true)
+		{
+			GroupType Group(Ctrl + Pos);
+			typename GroupType::BitMaskType EmptyOrDeleted = Group.MatchEmptyOrDeleted();
+
+			if (EmptyOrDeleted)
+			{
+				return (Pos + EmptyOrDeleted.GetLowestBitIndex()) & Mask;
+			}
+
+			ProbeIndex += GroupWidth;
+			Pos = (Pos + ProbeIndex) & Mask;
+
+			GLX_ASSERT(ProbeIndex <= Capacity);
+		}
+	}
+
+	void AllocateStorage(SizeType InCapacity)
+	{
+		GLX_ASSERT(GlxBitUtils::IsPowerOfTwo(static_cast<GlxUInt64>(InCapacity)) && InCapacity >= MinCapacity);
+
+		const GlxSizeT CtrlBytes = static_cast<GlxSizeT>(InCapacity + GroupWidth);
+		const GlxSizeT SlotOffset = (CtrlBytes + alignof(NodeType) - 1) & ~(alignof(NodeType) - 1);
+
+		GlxByte* Memory = static_cast<GlxByte*>(GLX_MALLOC(SlotOffset + static_cast<GlxSizeT>(InCapacity) * sizeof(NodeType)));
+
+		Ctrl = reinterpret_cast<CtrlType*>(Memory);
+		Slots = reinterpret_cast<NodeType*>(Memory + SlotOffset);
+		Capacity = InCapacity;
+		GrowthLeft = CapacityToGrowth(InCapacity) - ElementCount;
+
+		GLX_MEMSET(Ctrl, GlxNsPrivate::FlatCtrlEmpty, CtrlBytes);
+	}
+
+	void DestructSlots()
+	{
+		if constexpr (!GlxIsTriviallyDestructible<ElementType>::Value)
+		{
+			for (SizeType Index = 0; Index < Capacity; ++Index)
+			{
+				if (Ctrl[Index] >= 0)
+				{
+					Slots[Index].Element.~ElementType();
+				}
+			}
+		}
+	}
+
+	void RehashImpl(SizeType InNewCapacity)
+	{
+		CtrlType* OldCtrl = Ctrl;
+		NodeType* OldSlots = Slots;
+		const SizeType OldCapacity = Capacity;
+
+		AllocateStorage(InNewCapacity);
+
+		for (SizeType Index = 0; Index < OldCapacity; ++Index)
+		{
+			if (OldCtrl[Index] >= 0)
+			{
+				ElementType& Element = OldSlots[Index].Element;
+				const GlxSizeT Mixed = MixHash(Element.HashCode);
+				const SizeType NewIndex = FindFirstNonFull(Mixed);
+
+				SetCtrl(NewIndex, GetH2(Mixed));
+				GlxMemoryUtils::MoveConstructElements<ElementType, SizeType>(&Slots[NewIndex].Element, &Element, 1);
+
+				if constexpr (!GlxIsTriviallyDestructible<ElementType>::Value)
+				{
+					Element.~ElementType();
+				}
+			}
+		}
+
+		if (OldCtrl)
+		{
+			GLX_FREE(OldCtrl);
+		}
+	}
+
+	void CopyFrom(const GlxFlatHashMap& InOther)
+	{
+		if (InOther.Capacity == 0)
+		{
+			return;
+		}
+
+		ElementCount = InOther.ElementCount;
+		AllocateStorage(InOther.Capacity);
+		GrowthLeft = InOther.GrowthLeft;
+
+		GLX_MEMCPY(Ctrl, InOther.Ctrl, static_cast<GlxSizeT>(Capacity + GroupWidth));
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				new (&Slots[Index].Element) ElementType(InOther.Slots[Index].Element);
+			}
+		}
+	}
+
+	SizeType PrepareInsert(GlxSizeT InMixedHash)
+	{
+		if (Capacity == 0)
+		{
+			RehashImpl(MinCapacity);
+		}
+
+		SizeType Index = FindFirstNonFull(InMixedHash);
+
+		if (GrowthLeft == 0 && Ctrl[Index] != GlxNsPrivate::FlatCtrlDeleted)
+		{
+			// Out of empty slots: grow, or rebuild at the same capacity to drop the tombstones if they take up most of the budget.
+			if (ElementCount * 2 >= CapacityToGrowth(Capacity))
+			{
+				RehashImpl(Capacity * 2);
+			}
+			else
+			{
+				RehashImpl(Capacity);
+			}
+
+			Index = FindFirstNonFull(InMixedHash);
+		}
+
+		if (Ctrl[Index] == GlxNsPrivate::FlatCtrlEmpty)
+		{
+			--GrowthLeft;
+		}
+
+		++ElementCount;
+		SetCtrl(Index, GetH2(InMixedHash));
+
+		return Index;
+	}
+
+	void EraseAt(SizeType InIndex)
+	{
+		GLX_ASSERT(InIndex >= 0 && InIndex < Capacity && Ctrl[InIndex] >= 0);
+
+		if constexpr (!GlxIsTriviallyDestructible<ElementType>::Value)
+		{
+			Slots[InIndex].Element.~ElementType();
+		}
+
+		// If no run of GroupWidth full/deleted slots covers this index, no probe ever skipped past it and it can go straight back to Empty.
+		const SizeType IndexBefore = (InIndex - GroupWidth) & (Capacity - 1);
+		const typename GroupType::BitMaskType EmptyAfter = GroupType(Ctrl + InIndex).MatchEmpty();
+		const typename GroupType::BitMaskType EmptyBefore = GroupType(Ctrl + IndexBefore).MatchEmpty();
+
+		const GlxBool WasNeverFull = EmptyBefore && EmptyAfter &&
+			static_cast<SizeType>(EmptyAfter.CountTrailingZeros() + EmptyBefore.CountLeadingZeros()) < GroupWidth;
+
+		SetCtrl(InIndex, WasNeverFull ? GlxNsPrivate::FlatCtrlEmpty : GlxNsPrivate::FlatCtrlDeleted);
+		GrowthLeft += WasNeverFull ? 1 : 0;
+		--ElementCount;
+	}
+
+	GLX_FORCE_INLINE GlxBool RemoveAtIndex(SizeType InIndex)
+	{
+		if (InIndex == GLX_INVALID_INDEX)
+		{
+			return false;
+		}
+
+		EraseAt(InIndex);
+		return true;
+	}
+
+	template<typename K, typename... TArgs>
+	NodeType* EmplaceByHashImpl(HashCodeType InHash, K&& InKey, TArgs&&... InArgs)
+	{
+		if (FindIndex(InHash, InKey) != GLX_INVALID_INDEX)
+		{
+			return nullptr;
+		}
+
+		const SizeType Index = PrepareInsert(MixHash(InHash));
+		new (&Slots[Index].Element) ElementType(InHash, Forward<K>(InKey), Forward<TArgs>(InArgs)...);
+		return Slots + Index;
+	}
+
+	template<typename K, typename... TArgs>
+	NodeType* EmplaceOrAssignImpl(HashCodeType InHash, K&& InKey, TArgs&&... InArgs)
+	{
+		const SizeType FoundIndex = FindIndex(InHash, InKey);
+
+		if (FoundIndex != GLX_INVALID_INDEX)
+		{
+			Slots[FoundIndex].Element.Value = ValueType(Forward<TArgs>(InArgs)...);
+			return Slots + FoundIndex;
+		}
+
+		const SizeType Index = PrepareInsert(MixHash(InHash));
+		new (&Slots[Index].Element) ElementType(InHash, Forward<K>(InKey), Forward<TArgs>(InArgs)...);
+		return Slots + Index;
+	}
+
+	template<GlxBool InAssign>
+	void InsertInitListImpl(SizeType InPairCount, const PairType* InBegin, const PairType* InEnd)
+	{
+		Reserve(ElementCount + InPairCount);
+
+		for (; InBegin != InEnd; ++InBegin)
+		{
+			if constexpr (InAssign)
+			{
+				EmplaceOrAssignImpl(KeyHasherType::GetHashCode(InBegin->First), InBegin->First, InBegin->Second);
+			}
+			else
+			{
+				EmplaceByHashImpl(KeyHasherType::GetHashCode(InBegin->First), InBegin->First, InBegin->Second);
+			}
+		}
+	}
+
+	template<typename K>
+	ValueType& GetValueByKey(K&& InKey)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		SizeType Index = FindIndex(HashCode, InKey);
+
+		if (Index == GLX_INVALID_INDEX)
+		{
+			Index = PrepareInsert(MixHash(HashCode));
+			new (&Slots[Index].Element) ElementType(HashCode, Forward<K>(InKey));
+		}
+
+		return Slots[Index].Element.Value;
+	}
+
+public:
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* EmplaceByHash(HashCodeType InHash, const KeyType& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceByHashImpl(InHash, InKey, Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* EmplaceByHash(HashCodeType InHash, KeyType&& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceByHashImpl(InHash, Move(InKey), Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* Emplace(const KeyType& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceByHashImpl(KeyHasherType::GetHashCode(InKey), InKey, Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* Emplace(KeyType&& InKey, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		return EmplaceByHashImpl(HashCode, Move(InKey), Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* EmplaceOrAssign(const KeyType& InKey, TArgs&&... InArgs)
+	{
+		return EmplaceOrAssignImpl(KeyHasherType::GetHashCode(InKey), InKey, Forward<TArgs>(InArgs)...);
+	}
+
+	template<typename... TArgs>
+	GLX_FORCE_INLINE NodeType* EmplaceOrAssign(KeyType&& InKey, TArgs&&... InArgs)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKey);
+		return EmplaceOrAssignImpl(HashCode, Move(InKey), Forward<TArgs>(InArgs)...);
+	}
+
+	GLX_FORCE_INLINE NodeType* Insert(const PairType& InKV)
+	{
+		return EmplaceByHashImpl(KeyHasherType::GetHashCode(InKV.First), InKV.First, InKV.Second);
+	}
+
+	GLX_FORCE_INLINE NodeType* Insert(PairType&& InKV)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKV.First);
+		return EmplaceByHashImpl(HashCode, Move(InKV.First), Move(InKV.Second));
+	}
+
+	GLX_FORCE_INLINE NodeType* InsertOrAssign(const PairType& InKV)
+	{
+		return EmplaceOrAssignImpl(KeyHasherType::GetHashCode(InKV.First), InKV.First, InKV.Second);
+	}
+
+	GLX_FORCE_INLINE NodeType* InsertOrAssign(PairType&& InKV)
+	{
+		const HashCodeType HashCode = KeyHasherType::GetHashCode(InKV.First);
+		return EmplaceOrAssignImpl(HashCode, Move(InKV.First), Move(InKV.Second));
+	}
+
+	GLX_FORCE_INLINE void Insert(std::initializer_list<PairType> InPairs)
+	{
+		InsertInitListImpl<false>(static_cast<SizeType>(InPairs.size()), InPairs.begin(), InPairs.end());
+	}
+
+	GLX_FORCE_INLINE void InsertOrAssign(std::initializer_list<PairType> InPairs)
+	{
+		InsertInitListImpl<true>(static_cast<SizeType>(InPairs.size()), InPairs.begin(), InPairs.end());
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE ValueType& operator[](const KeyType& InKey)
+	{
+		return GetValueByKey(InKey);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE ValueType& operator[](KeyType&& InKey)
+	{
+		return GetValueByKey(Move(InKey));
+	}
+
+	GLX_NODISCARD ValueType& At(const KeyType& InKey)
+	{
+		NodeType* FoundNode = Find(InKey);
+		GLX_ASSERT(FoundNode);
+		return FoundNode->Element.Value;
+	}
+
+	GLX_NODISCARD const ValueType& At(const KeyType& InKey) const
+	{
+		const NodeType* FoundNode = Find(InKey);
+		GLX_ASSERT(FoundNode);
+		return FoundNode->Element.Value;
+	}
+
+	// Returns whether an element was removed. Slots never move, so an iterator to another element stays valid and
+	// advancing past the removed one just skips its now-empty slot.
+	GLX_FORCE_INLINE GlxBool Remove(const KeyType& InKey)
+	{
+		return RemoveAtIndex(FindIndex(KeyHasherType::GetHashCode(InKey), InKey));
+	}
+
+	GLX_FORCE_INLINE GlxBool RemoveAt(IteratorType InIt)
+	{
+		return RemoveAtIndex(InIt.Index);
+	}
+
+	GLX_FORCE_INLINE GlxBool RemoveByHash(const HashCodeType InHash)
+	{
+		return RemoveAtIndex(FindIndexByHash(InHash));
+	}
+
+	SizeType GetKeys(GlxDynamicArray<KeyType>& InArr) const
+	{
+		InArr.Reserve(InArr.GetElementCount() + ElementCount);
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				InArr.EmplaceBack(Slots[Index].Element.Key);
+			}
+		}
+
+		return InArr.GetElementCount();
+	}
+
+	SizeType GetValues(GlxDynamicArray<ValueType>& InArr) const
+	{
+		InArr.Reserve(InArr.GetElementCount() + ElementCount);
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				InArr.EmplaceBack(Slots[Index].Element.Value);
+			}
+		}
+
+		return InArr.GetElementCount();
+	}
+
+	SizeType GetElements(GlxDynamicArray<ElementType>& InArr) const
+	{
+		InArr.Reserve(InArr.GetElementCount() + ElementCount);
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0)
+			{
+				InArr.EmplaceBack(Slots[Index].Element);
+			}
+		}
+
+		return InArr.GetElementCount();
+	}
+
+	template<typename TPredicate>
+	void FilterKeys(TPredicate InPred, GlxDynamicArray<KeyType>& InArr) const
+	{
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0 && InPred(Slots[Index].Element.Key))
+			{
+				InArr.EmplaceBack(Slots[Index].Element.Key);
+			}
+		}
+	}
+
+	template<typename TPredicate>
+	void FilterValues(TPredicate InPred, GlxDynamicArray<ValueType>& InArr) const
+	{
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0 && InPred(Slots[Index].Element.Value))
+			{
+				InArr.EmplaceBack(Slots[Index].Element.Value);
+			}
+		}
+	}
+
+	template<typename TPredicate>
+	void FilterElements(TPredicate InPred, GlxDynamicArray<ElementType>& InArr) const
+	{
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			if (Ctrl[Index] >= 0 && InPred(Slots[Index].Element))
+			{
+				InArr.EmplaceBack(Slots[Index].Element);
+			}
+		}
+	}
+
+private:
+	CtrlType* Ctrl;
+	NodeType* Slots;
+	SizeType ElementCount;
+	SizeType Capacity;
+	SizeType GrowthLeft;
+};
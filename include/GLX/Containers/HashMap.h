@@ -2,21 +2,101 @@
 
 #include "GLX/Assert.h"
 #include "GLX/Types/Pair.h"
+#include "GLX/Utils/BitUtils.h"
 #include "GLX/Utils/HashFunctions.h"
 #include "GLX/TypeTraits/EnableIf.h"
 #include "GLX/TypeTraits/TypeChooser.h"
+#include "GLX/TypeTraits/RemoveCVRef.h"
 #include "GLX/TypeTraits/RemoveReference.h"
+#include "GLX/TypeTraits/TypeRelationships.h"
 #include "GLX/TypeTraits/IsRvalueReference.h"
 
 #include "DynamicArray.h"
 
-template<typename TKey, typename TValue, typename TKeyHasher = GlxHasher<TKey>>
+class GlxPowerOfTwoBucketPolicy
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GLX_CONSTEXPR SizeType MinBucketCount = 2;
+
+	static GLX_FORCE_INLINE SizeType RoundBucketCount(SizeType InMinCount)
+	{
+		return static_cast<SizeType>(GlxBitUtils::RoundUpToPowerOfTwo(static_cast<GlxUInt64>(GLX_MAX(InMinCount, MinBucketCount))));
+	}
+
+	GLX_FORCE_INLINE void SetBucketCount(SizeType InCount)
+	{
+		GLX_ASSERT(GlxBitUtils::IsPowerOfTwo(static_cast<GlxUInt64>(InCount)));
+		Shift = 64 - GlxBitUtils::FloorLog2(static_cast<GlxUInt64>(InCount));
+	}
+
+	// Fibonacci hashing: the multiply spreads weak hashes (e.g. shifted pointers) over the top bits, which become the index.
+	GLX_FORCE_INLINE SizeType GetBucketIndex(GlxSizeT InHash) const
+	{
+		return static_cast<SizeType>((static_cast<GlxUInt64>(InHash) * 0x9E3779B97F4A7C15ULL) >> Shift);
+	}
+
+private:
+	GlxUInt32 Shift = 63;
+};
+
+class GlxPrimeBucketPolicy
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GLX_CONSTEXPR GlxUInt32 Primes[] =
+	{
+		2U, 5U, 11U, 23U, 47U, 97U, 197U, 397U, 797U, 1597U, 3203U, 6421U, 12853U, 25717U, 51437U, 102877U,
+		205759U, 411527U, 823117U, 1646237U, 3292489U, 6584983U, 13169977U, 26339969U, 52679969U, 105359939U,
+		210719881U, 421439783U, 842879579U, 1685759167U, 3371518343U, 4294967291U
+	};
+
+	static SizeType RoundBucketCount(SizeType InMinCount)
+	{
+		for (GlxUInt32 Prime : Primes)
+		{
+			if (static_cast<SizeType>(Prime) >= InMinCount)
+			{
+				return static_cast<SizeType>(Prime);
+			}
+		}
+
+		GLX_ASSERT(false && "Bucket count exceeds the largest supported prime");
+		return static_cast<SizeType>(Primes[sizeof(Primes) / sizeof(Primes[0]) - 1]);
+	}
+
+	GLX_FORCE_INLINE void SetBucketCount(SizeType InCount)
+	{
+		GLX_ASSERT(InCount > 0 && InCount <= 0xFFFFFFFFLL);
+		Divisor = static_cast<GlxUInt64>(InCount);
+		Multiplier = 0xFFFFFFFFFFFFFFFFULL / Divisor + 1;
+	}
+
+	// Lemire's fastmod: the 64-bit hash is folded to 32 bits and reduced with two multiplies instead of a div.
+	GLX_FORCE_INLINE SizeType GetBucketIndex(GlxSizeT InHash) const
+	{
+		const GlxUInt64 Hash = static_cast<GlxUInt64>(InHash);
+		const GlxUInt32 Folded = static_cast<GlxUInt32>(Hash ^ (Hash >> 32));
+		return static_cast<SizeType>(GlxBitUtils::MultiplyHigh(Multiplier * Folded, Divisor));
+	}
+
+private:
+	GlxUInt64 Divisor = 1;
+	GlxUInt64 Multiplier = 0;
+};
+
+// Node stability: a NodeType* returned by Find, Emplace, EmplaceOrAssign, Insert or operator[] stays valid
+// until that element is removed or the map is cleared, released or assigned to. Rehashing never moves nodes.
+template<typename TKey, typename TValue, typename TKeyHasher = GlxHasher<TKey>, typename TBucketPolicy = GlxPowerOfTwoBucketPolicy>
 class GlxHashMap
 {
 public:
 	using KeyType = TKey;
 	using ValueType = TValue;
 	using KeyHasherType = TKeyHasher;
+	using BucketPolicyType = TBucketPolicy;
 	using HashCodeType = GlxSizeT;
 
 	using SizeType = GlxInt64;
@@ -25,32 +105,32 @@ public:
 	class GlxElement
 	{
 	public:
-		friend class GlxHashMap<TKey, TValue, TKeyHasher>;
+		friend class GlxHashMap<TKey, TValue, TKeyHasher, TBucketPolicy>;
 
 		using HashCodeType = GlxSizeT;
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, const KeyType& InKey, const ValueType& InVal)
-			: HashCode(InHash), Key(InKey), Value(InVal)
+			: Key(InKey), Value(InVal), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, KeyType&& InKey, ValueType&& InVal) noexcept
-			: HashCode(InHash), Key(Move(InKey)), Value(Move(InVal))
+			: Key(Move(InKey)), Value(Move(InVal)), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, const KeyType& InKey, ValueType&& InVal)
-			: HashCode(InHash), Key(InKey), Value(Move(InVal))
+			: Key(InKey), Value(Move(InVal)), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, KeyType&& InKey, const ValueType& InVal)
-			: HashCode(InHash), Key(Move(InKey)), Value(InVal)
+			: Key(Move(InKey)), Value(InVal), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, const KeyType& InKey)
-			: HashCode(InHash), Key(InKey), Value()
+			: Key(InKey), Value(), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE GlxElement(HashCodeType InHash, KeyType&& InKey) noexcept
-			: HashCode(InHash), Key(Move(InKey)), Value()
+			: Key(Move(InKey)), Value(), HashCode(InHash)
 		{}
 
 		GLX_FORCE_INLINE HashCodeType GetHashCode() const
@@ -90,6 +170,9 @@ public:
 		return KeyHasherType::GetHashCode(InKey);
 	}
 
+	template<typename TOtherKey>
+	using GlxEnableIfTransparentKey = GlxEnableIf<GlxIsTransparentHasher<KeyHasherType>::Value && !GlxIsSame<typename GlxRemoveCVRef<TOtherKey>::Type, KeyType>::Value>;
+
 	static GLX_CONSTEXPR GLX_FORCE_INLINE GlxFloat GetMaxLoadFactor()
 	{
 		return MaxLoadFactor;
@@ -178,6 +261,23 @@ public:
 			return NewNode;
 		}
 
+		void LinkBack(NodeType* InNode)
+		{
+			InNode->Next = nullptr;
+
+			if (Tail)
+			{
+				Tail->Next = InNode;
+			}
+			else
+			{
+				Head = InNode;
+			}
+
+			Tail = InNode;
+			++Count;
+		}
+
 		NodeType* Head;
 		NodeType* Tail;
 		SizeType Count;
@@ -191,7 +291,7 @@ public:
 	class GlxIteratorBase
 	{
 	public:
-		friend class GlxHashMap<KeyType, ValueType, KeyHasherType>;
+		friend class GlxHashMap<KeyType, ValueType, KeyHasherType, BucketPolicyType>;
 
 		using HashMapType = typename GlxTypeChooser<InIsConst, const GlxHashMap, GlxHashMap>::Type;
 		using ListType    = typename GlxTypeChooser<InIsConst, const ElementListType, ElementListType>::Type;
@@ -355,7 +455,8 @@ public:
 	GlxHashMap(const GlxHashMap& InOther)
 		:	ElementCount(InOther.ElementCount),
 			NumList(InOther.NumList),
-			Lists(NumList > 0 ? static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType))) : nullptr)
+			Lists(NumList > 0 ? static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType))) : nullptr),
+			BucketPolicy(InOther.BucketPolicy)
 	{
 		for (SizeType Index = 0; Index < NumList; ++Index)
 		{
@@ -366,7 +467,8 @@ public:
 	GlxHashMap(GlxHashMap&& InOther) noexcept
 		:	ElementCount(InOther.ElementCount),
 			NumList(InOther.NumList),
-			Lists(InOther.Lists)
+			Lists(InOther.Lists),
+			BucketPolicy(InOther.BucketPolicy)
 	{
 		InOther.ElementCount = 0;
 		InOther.NumList = 0;
@@ -380,13 +482,14 @@ public:
 
 		if ((static_cast<GlxFloat>(PairCount) / static_cast<GlxFloat>(InitialNumList)) > MaxLoadFactor)
 		{
-			NumList = static_cast<SizeType>(static_cast<GlxFloat>(PairCount) / MaxLoadFactor) + 1;
+			NumList = BucketPolicyType::RoundBucketCount(static_cast<SizeType>(static_cast<GlxFloat>(PairCount) / MaxLoadFactor) + 1);
 		}
 		else
 		{
-			NumList = InitialNumList;
+			NumList = BucketPolicyType::RoundBucketCount(InitialNumList);
 		}
 
+		BucketPolicy.SetBucketCount(NumList);
 		Lists = static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType)));
 		for (SizeType Index = 0; Index < NumList; ++Index)
 		{
@@ -403,7 +506,7 @@ public:
 
 			if (!FoundNode)
 			{
-				Lists[HashCode % NumList].EmplaceBack(HashCode, Begin->First, Begin->Second);
+				Lists[BucketPolicy.GetBucketIndex(HashCode)].EmplaceBack(HashCode, Begin->First, Begin->Second);
 				++ElementCount;
 			}
 
@@ -413,9 +516,14 @@ public:
 
 	explicit GlxHashMap(const SizeType InNumList)
 		:	ElementCount(0),
-			NumList(InNumList > 0 ? InNumList : 0),
+			NumList(InNumList > 0 ? BucketPolicyType::RoundBucketCount(InNumList) : 0),
 			Lists(NumList > 0 ? static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType))) : nullptr)
 	{
+		if (NumList > 0)
+		{
+			BucketPolicy.SetBucketCount(NumList);
+		}
+
 		for (SizeType Index = 0; Index < NumList; ++Index)
 		{
 			new (Lists + Index) ElementListType();
@@ -474,6 +582,7 @@ public:
 
 			ElementCount = InOther.ElementCount;
 			NumList = InOther.NumList;
+			BucketPolicy = InOther.BucketPolicy;
 			Lists = static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType)));
 			for (SizeType Index = 0; Index < NumList; ++Index)
 			{
@@ -498,6 +607,7 @@ public:
 			Lists = InOther.Lists;
 			NumList = InOther.NumList;
 			ElementCount = InOther.ElementCount;
+			BucketPolicy = InOther.BucketPolicy;
 
 			InOther.Lists = nullptr;
 			InOther.NumList = 0;
@@ -531,7 +641,7 @@ public:
 
 	GLX_FORCE_INLINE SizeType GetListIndexByKey(const KeyType& InKey) const
 	{
-		return KeyHasherType::GetHashCode(InKey) % NumList;
+		return BucketPolicy.GetBucketIndex(KeyHasherType::GetHashCode(InKey));
 	}
 
 	GLX_FORCE_INLINE GlxBool IsEmpty() const
@@ -568,7 +678,7 @@ public:
 	{
 		if (NumList > 0)
 		{
-			NodeType* Node = Lists[InHash % NumList].Head;
+			NodeType* Node = Lists[BucketPolicy.GetBucketIndex(InHash)].Head;
 
 			while (Node)
 			{
@@ -588,7 +698,7 @@ public:
 	{
 		if (NumList > 0)
 		{
-			const NodeType* Node = Lists[InHash % NumList].Head;
+			const NodeType* Node = Lists[BucketPolicy.GetBucketIndex(InHash)].Head;
 
 			while (Node)
 			{
@@ -623,6 +733,42 @@ public:
 		return FindByHash(InHash) != nullptr;
 	}
 
+	template<typename TOtherKey, typename = typename GlxEnableIfTransparentKey<TOtherKey>::Type>
+	GLX_FORCE_INLINE NodeType* Find(const TOtherKey& InKey)
+	{
+		return FindByHash(KeyHasherType::GetHashCode(InKey));
+	}
+
+	template<typename TOtherKey, typename = typename GlxEnableIfTransparentKey<TOtherKey>::Type>
+	GLX_FORCE_INLINE const NodeType* Find(const TOtherKey& InKey) const
+	{
+		return FindByHash((const HashCodeType)KeyHasherType::GetHashCode(InKey));
+	}
+
+	template<typename TChar, typename = typename GlxEnableIfTransparentKey<const TChar*>::Type>
+	GLX_FORCE_INLINE NodeType* Find(const TChar* InData, SizeType InLength)
+	{
+		return FindByHash(KeyHasherType::GetHashCode(InData, static_cast<GlxSizeT>(InLength)));
+	}
+
+	template<typename TChar, typename = typename GlxEnableIfTransparentKey<const TChar*>::Type>
+	GLX_FORCE_INLINE const NodeType* Find(const TChar* InData, SizeType InLength) const
+	{
+		return FindByHash((const HashCodeType)KeyHasherType::GetHashCode(InData, static_cast<GlxSizeT>(InLength)));
+	}
+
+	template<typename TOtherKey, typename = typename GlxEnableIfTransparentKey<TOtherKey>::Type>
+	GLX_FORCE_INLINE GlxBool Contains(const TOtherKey& InKey) const
+	{
+		return FindByHash((const HashCodeType)KeyHasherType::GetHashCode(InKey)) != nullptr;
+	}
+
+	template<typename TChar, typename = typename GlxEnableIfTransparentKey<const TChar*>::Type>
+	GLX_FORCE_INLINE GlxBool Contains(const TChar* InData, SizeType InLength) const
+	{
+		return FindByHash((const HashCodeType)KeyHasherType::GetHashCode(InData, static_cast<GlxSizeT>(InLength))) != nullptr;
+	}
+
 	GlxBool operator==(const GlxHashMap& InOther) const
 	{
 		if (ElementCount != InOther.ElementCount)
@@ -659,7 +805,8 @@ private:
 	void RehashImpl(SizeType InNewNumList)
 	{
 		SizeType OldNumList = NumList;
-		NumList = InNewNumList;
+		NumList = BucketPolicyType::RoundBucketCount(InNewNumList);
+		BucketPolicy.SetBucketCount(NumList);
 
 		ElementListType* NewLists = static_cast<ElementListType*>(GLX_MALLOC(NumList * sizeof(ElementListType)));
 
@@ -668,16 +815,22 @@ private:
 			new (NewLists + Index) ElementListType();
 		}
 
+		// Nodes are relinked into the new lists rather than reallocated, so a rehash performs no
+		// per-element allocation and every NodeType* handed out by the map stays valid.
 		for (SizeType Index = 0; Index < OldNumList; ++Index)
 		{
 			NodeType* Node = Lists[Index].Head;
 
 			while (Node)
 			{
-				NewLists[Node->Element.HashCode % NumList].EmplaceBack(Node->Element.HashCode, Move(Node->Element.Key), Move(Node->Element.Value));
-				Node = Node->Next;
+				NodeType* Next = Node->Next;
+				NewLists[BucketPolicy.GetBucketIndex(Node->Element.HashCode)].LinkBack(Node);
+				Node = Next;
 			}
 
+			Lists[Index].Head = nullptr;
+			Lists[Index].Tail = nullptr;
+			Lists[Index].Count = 0;
 			Lists[Index].~ElementListType();
 		}
 
@@ -711,11 +864,11 @@ private:
 
 			if constexpr (GlxIsRvalueReference<K>::Value)
 			{
-				return Lists[InHash % NumList].EmplaceBack(InHash, Move(InKey), ValueType(Forward<TArgs>(InArgs)...));
+				return Lists[BucketPolicy.GetBucketIndex(InHash)].EmplaceBack(InHash, Move(InKey), ValueType(Forward<TArgs>(InArgs)...));
 			}
 			else
 			{
-				return Lists[InHash % NumList].EmplaceBack(InHash, InKey, ValueType(Forward<TArgs>(InArgs)...));
+				return Lists[BucketPolicy.GetBucketIndex(InHash)].EmplaceBack(InHash, InKey, ValueType(Forward<TArgs>(InArgs)...));
 			}
 		}
 
@@ -737,11 +890,11 @@ private:
 
 			if constexpr (GlxIsRvalueReference<K>::Value)
 			{
-				return Lists[InHash % NumList].EmplaceBack(InHash, Move(InKey), ValueType(Forward<TArgs>(InArgs)...));
+				return Lists[BucketPolicy.GetBucketIndex(InHash)].EmplaceBack(InHash, Move(InKey), ValueType(Forward<TArgs>(InArgs)...));
 			}
 			else
 			{
-				return Lists[InHash % NumList].EmplaceBack(InHash, InKey, ValueType(Forward<TArgs>(InArgs)...));
+				return Lists[BucketPolicy.GetBucketIndex(InHash)].EmplaceBack(InHash, InKey, ValueType(Forward<TArgs>(InArgs)...));
 			}
 		}
 
@@ -771,7 +924,7 @@ private:
 			if (!FoundNode)
 			{
 				++ElementCount;
-				Lists[HashCode % NumList].EmplaceBack(HashCode, Begin->First, Begin->Second);
+				Lists[BucketPolicy.GetBucketIndex(HashCode)].EmplaceBack(HashCode, Begin->First, Begin->Second);
 			}
 
 			++Begin;
@@ -782,7 +935,7 @@ public:
 	void Rehash(SizeType InNewNumList)
 	{
 		SizeType Num = static_cast<SizeType>(static_cast<GlxFloat>(ElementCount) / MaxLoadFactor) + 1;
-		InNewNumList = GLX_MAX(InNewNumList, Num);
+		InNewNumList = BucketPolicyType::RoundBucketCount(GLX_MAX(InNewNumList, Num));
 
 		if (InNewNumList > NumList)
 		{
@@ -867,13 +1020,17 @@ private:
 		{
 			RehashForInsertion(++ElementCount);
 
-			if constexpr (GlxIsRvalueReference<K>::Value)
+			if constexpr (!GlxIsSame<typename GlxRemoveCVRef<K>::Type, KeyType>::Value)
+			{
+				Node = Lists[BucketPolicy.GetBucketIndex(HashCode)].EmplaceBack(HashCode, KeyType(InKey));
+			}
+			else if constexpr (GlxIsRvalueReference<K>::Value)
 			{
-				Node = Lists[HashCode % NumList].EmplaceBack(HashCode, Move(InKey));
+				Node = Lists[BucketPolicy.GetBucketIndex(HashCode)].EmplaceBack(HashCode, Move(InKey));
 			}
 			else
 			{
-				Node = Lists[HashCode % NumList].EmplaceBack(HashCode, InKey);
+				Node = Lists[BucketPolicy.GetBucketIndex(HashCode)].EmplaceBack(HashCode, InKey);
 			}
 		}
 
@@ -891,6 +1048,13 @@ public:
 		return GetValueByKey<KeyType&&>(Move(InKey));
 	}
 
+	// The key is only materialized when the element does not exist yet.
+	template<typename TOtherKey, typename = typename GlxEnableIfTransparentKey<TOtherKey>::Type>
+	GLX_NODISCARD GLX_FORCE_INLINE ValueType& operator[](const TOtherKey& InKey)
+	{
+		return GetValueByKey<const TOtherKey&>(InKey);
+	}
+
 	GLX_NODISCARD ValueType& At(const KeyType& InKey)
 	{
 		NodeType* FoundNode = FindByHash(KeyHasherType::GetHashCode(InKey));
@@ -910,6 +1074,18 @@ public:
 		return RemoveByHash(KeyHasherType::GetHashCode(InKey));
 	}
 
+	template<typename TOtherKey, typename = typename GlxEnableIfTransparentKey<TOtherKey>::Type>
+	GLX_FORCE_INLINE NodeType* Remove(const TOtherKey& InKey)
+	{
+		return RemoveByHash(KeyHasherType::GetHashCode(InKey));
+	}
+
+	template<typename TChar, typename = typename GlxEnableIfTransparentKey<const TChar*>::Type>
+	GLX_FORCE_INLINE NodeType* Remove(const TChar* InData, SizeType InLength)
+	{
+		return RemoveByHash(KeyHasherType::GetHashCode(InData, static_cast<GlxSizeT>(InLength)));
+	}
+
 	GLX_FORCE_INLINE NodeType* RemoveAt(IteratorType InIt)
 	{
 		return RemoveByHash(InIt.CurrentNode->Element.HashCode);
@@ -917,7 +1093,12 @@ public:
 
 	NodeType* RemoveByHash(const HashCodeType InHash)
 	{
-		ElementListType& List = Lists[InHash % NumList];
+		if (NumList == 0)
+		{
+			return nullptr;
+		}
+
+		ElementListType& List = Lists[BucketPolicy.GetBucketIndex(InHash)];
 
 		if (!List.Count || !List.Head)
 		{
@@ -938,6 +1119,11 @@ public:
 			Node = Node->Next;
 		}
 
+		if (!Node)
+		{
+			return nullptr;
+		}
+
 		NodeType* Tmp = nullptr;
 		NodeType* Ret = nullptr;
 		if (Node == List.Head)
@@ -945,6 +1131,11 @@ public:
 			Tmp = List.Head;
 			List.Head = List.Head->Next;
 			Ret = List.Head;
+
+			if (!List.Head)
+			{
+				List.Tail = nullptr;
+			}
 		}
 		else if (Node == List.Tail)
 		{
@@ -961,6 +1152,7 @@ public:
 		}
 
 		delete Tmp;
+		--List.Count;
 		--ElementCount;
 
 		return Ret;
@@ -1078,4 +1270,5 @@ private:
 	SizeType ElementCount;
 	SizeType NumList;
 	ElementListType* Lists;
+	BucketPolicyType BucketPolicy;
 };
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "GLX/Memory/Allocators.h"
+
+#include "DynamicArray.h"
+
+// Small-vector: the first InInlineCount elements live inside the array object and only larger arrays spill to the heap.
+// Shares the whole GlxDynamicArray API.
+template<typename T, GlxInt64 InInlineCount, typename TFallbackAllocator = GlxHeapAllocator>
+using GlxInlineArray = GlxDynamicArray<T, GlxInlineAllocator<static_cast<GlxSizeT>(InInlineCount) * sizeof(T), alignof(T), TFallbackAllocator>>;
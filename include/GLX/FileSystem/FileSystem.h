@@ -2,6 +2,7 @@
 
 #include "Path.h"
 #include "GLX/String/String.h"
+#include "GLX/String/StringView.h"
 #include "GLX/Containers/DynamicArray.h"
 
 #if defined(GLX_PLATFORM_WINDOWS)
@@ -58,6 +59,11 @@ public:
 	static GlxString GetExtension(const GlxString& InPath);
 	static GlxString GetFileName(const GlxString& InPath);
 	static GlxString GetFileNameWithoutExtension(const GlxString& InPath);
+
+	// View variants return slices of InPath and do not allocate.
+	static GlxStringView GetExtensionView(GlxStringView InPath);
+	static GlxStringView GetFileNameView(GlxStringView InPath);
+	static GlxStringView GetFileNameWithoutExtensionView(GlxStringView InPath);
 	static GlxBool IsPathSeparator(GlxChar InChar);
 };
 
@@ -135,100 +141,45 @@ GlxPath GlxFileSystem::GetRelativePath(const GlxPath& InPath, const GlxPath& InB
 	return std::filesystem::relative(InPath, InBase);
 }
 
-GlxString GlxFileSystem::GetExtension(const GlxString& InPath)
+GlxStringView GlxFileSystem::GetExtensionView(GlxStringView InPath)
 {
-	if (InPath.IsEmpty())
-	{
-		return "";
-	}
+	const GlxStringView FileName = GetFileNameView(InPath);
+	const GlxStringView::SizeType DotPos = FileName.FindLastChar('.');
+	return DotPos != GlxStringView::InvalidIndex ? FileName.Substring(DotPos) : GlxStringView();
+}
 
-	const GlxChar* Start = InPath.GetData();
-	const GlxChar* End = Start + InPath.GetElementCount();
-	const GlxChar* TmpEnd = End;
+GlxStringView GlxFileSystem::GetFileNameView(GlxStringView InPath)
+{
+	GlxStringView::SizeType Index = InPath.GetElementCount();
 
-	while (End >= Start)
+	while (Index > 0 && !IsPathSeparator(InPath[Index - 1]))
 	{
-		if (*End == '/' || *End == '\\')
-		{
-			return "";
-		}
-
-		if (*End == '.')
-		{
-			return GlxString(End, static_cast<typename GlxString::SizeType>(TmpEnd - End) + 1);
-		}
-
-		--End;
+		--Index;
 	}
 
-	return "";
+	return InPath.Substring(Index);
 }
 
-GlxString GlxFileSystem::GetFileName(const GlxString& InPath)
+GlxStringView GlxFileSystem::GetFileNameWithoutExtensionView(GlxStringView InPath)
 {
-	if (InPath.IsEmpty())
-	{
-		return "";
-	}
-
-	typename GlxString::SizeType Count = InPath.GetElementCount();
-	const GlxChar* Start = InPath.GetData();
-	const GlxChar* End = Start + Count;
-	const GlxChar* TmpEnd = End;
+	const GlxStringView FileName = GetFileNameView(InPath);
+	const GlxStringView::SizeType DotPos = FileName.FindLastChar('.');
+	return DotPos != GlxStringView::InvalidIndex ? FileName.Substring(0, DotPos) : FileName;
+}
 
-	while (End >= Start)
-	{
-		if (*End == '/' || *End == '\\')
-		{
-			++End;
-			return GlxString(End, static_cast<typename GlxString::SizeType>(TmpEnd - End) + 1);
-		}
-		--End;
-	}
+GlxString GlxFileSystem::GetExtension(const GlxString& InPath)
+{
+	return GetExtensionView(InPath).ToString();
+}
 
-	return Count > 0 ? InPath : "";
+GlxString GlxFileSystem::GetFileName(const GlxString& InPath)
+{
+	return GetFileNameView(InPath).ToString();
 }
 
 GlxString GlxFileSystem::GetFileNameWithoutExtension(const GlxString& InPath)
 {
-	if (InPath.IsEmpty())
-	{
-		return "";
-	}
-
-	const GlxChar* Start = InPath.GetData();
-	const GlxChar* End = Start + InPath.GetElementCount();
-	const GlxChar* TmpEnd = End;
-	const GlxChar* DotPos = nullptr;
-
-	while (End >= Start)
-	{
-		if (!DotPos && *End == '.')
-		{
-			DotPos = End;
-		}
-
-		if (*End == '/' || *End == '\\')
-		{
-			++End;
-			break;
-		}
-		--End;
-	}
-
-	if ((End + 1) == Start)
-	{
-		if (DotPos)
-		{
-			return GlxString(DotPos + 1, static_cast<typename GlxString::SizeType>(TmpEnd - DotPos));
-		}
-		else
-		{
-			return InPath;
-		}
-	}
-
-	return GlxString(End, static_cast<typename GlxString::SizeType>((DotPos ? DotPos : TmpEnd) - End));
+	return GetFileNameWithoutExtensionView(InPath).ToString();
 }
 
 GlxBool GlxFileSystem::IsPathSeparator(GlxChar InChar)
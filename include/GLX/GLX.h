@@ -2,8 +2,13 @@
 
 #include "Preprocessor.h"
 #include "Assert.h"
+#include "Algorithms/Algorithms.h"
+#include "Algorithms/ParallelAlgorithms.h"
+#include "Containers/ConcurrentHashMap.h"
 #include "Containers/DynamicArray.h"
+#include "Containers/FlatHashMap.h"
 #include "Containers/HashMap.h"
+#include "Containers/InlineArray.h"
 #include "Containers/List.h"
 #include "Containers/StaticArray.h"
 #include "FileSystem/FileIO.h"
@@ -12,7 +17,10 @@
 #include "Logging/LogLevel.h"
 #include "Logging/LogProperties.h"
 #include "Logging/LogRecord.h"
+#include "Logging/LogQueue.h"
 #include "Logging/Log.h"
+#include "Logging/BinaryLog.h"
+#include "Logging/FileLogSink.h"
 #include "Math/Constants.h"
 #include "Math/Vector2.h"
 #include "Math/Vector3.h"
@@ -20,13 +28,22 @@
 #include "Math/Mat3x3.h"
 #include "Math/Mat4x4.h"
 #include "Math/Math.h"
+#include "Memory/Allocators.h"
+#include "Memory/Arena.h"
 #include "Memory/MemoryUtils.h"
 #include "String/CharUtils.h"
 #include "String/CStringUtils.h"
+#include "String/StringSearch.h"
 #include "String/String.h"
+#include "String/StringView.h"
+#include "String/StringTokenizer.h"
+#include "String/StringBuilder.h"
+#include "String/Rope.h"
+#include "String/Name.h"
 #include "Threading/Atomic.h"
 #include "Threading/ConditionVariable.h"
 #include "Threading/Mutex.h"
+#include "Threading/ReadWriteLock.h"
 #include "Threading/ScopedLock.h"
 #include "Threading/Thread.h"
 #include "Types/DataTypes.h"
@@ -34,8 +51,10 @@
 #include "Types/Pair.h"
 #include "Types/Version.h"
 #include "TypeTraits/TypeTraits.h"
+#include "Utils/BitUtils.h"
 #include "Utils/CommandLine.h"
 #include "Utils/FromString.h"
+#include "Utils/Gzip.h"
 #include "Utils/HashFunctions.h"
 #include "Utils/Locale.h"
 #include "Utils/NonCopyable.h"
@@ -0,0 +1,841 @@
+#pragma once
+
+#include "Log.h"
+
+#include "GLX/String/StringView.h"
+#include "GLX/TypeTraits/Decay.h"
+#include "GLX/Containers/DynamicArray.h"
+
+#include "GLX/ThirdParty/fmt/args.h"
+
+#if defined(GLX_CPU_ARCH_X86)
+	#if defined(GLX_COMPILER_MSVC)
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#endif
+
+#include <type_traits>
+
+// How an argument is stored in a binary log record.
+enum class GlxEBinaryLogArg : GlxUInt8
+{
+	Bool,
+	Char,
+	Int8,
+	Int16,
+	Int32,
+	Int64,
+	UInt8,
+	UInt16,
+	UInt32,
+	UInt64,
+	Float,
+	Double,
+	Pointer,
+	String,
+};
+
+namespace GlxNsPrivate
+{
+	// Scalars (and enums, as their underlying type) are copied as-is. Strings are copied as a 32-bit length followed by
+	// the characters, since the pointer may not outlive the call. Other types do not compile.
+	template<typename T, typename = void>
+	class GlxBinaryLogArgTraits;
+
+	template<typename T>
+	class GlxBinaryLogArgTraits<T, typename GlxEnableIf<GlxIsArithmetic<T>::Value || GlxIsEnum<T>::Value || std::is_pointer_v<T>>::Type>
+	{
+		template<typename U>
+		static GLX_CONSTEXPR GlxEBinaryLogArg GetIntegerType()
+		{
+			if constexpr (std::is_signed_v<U>)
+			{
+				return sizeof(U) == 1 ? GlxEBinaryLogArg::Int8 : sizeof(U) == 2 ? GlxEBinaryLogArg::Int16 : sizeof(U) == 4 ? GlxEBinaryLogArg::Int32 : GlxEBinaryLogArg::Int64;
+			}
+			else
+			{
+				return sizeof(U) == 1 ? GlxEBinaryLogArg::UInt8 : sizeof(U) == 2 ? GlxEBinaryLogArg::UInt16 : sizeof(U) == 4 ? GlxEBinaryLogArg::UInt32 : GlxEBinaryLogArg::UInt64;
+			}
+		}
+
+		static GLX_CONSTEXPR GlxEBinaryLogArg GetType()
+		{
+			if constexpr (std::is_pointer_v<T>)
+			{
+				return GlxEBinaryLogArg::Pointer;
+			}
+			else if constexpr (GlxIsEnum<T>::Value)
+			{
+				return GetIntegerType<std::underlying_type_t<T>>();
+			}
+			else if constexpr (GlxIsSame<T, GlxBool>::Value)
+			{
+				return GlxEBinaryLogArg::Bool;
+			}
+			else if constexpr (GlxIsSame<T, GlxChar>::Value)
+			{
+				return GlxEBinaryLogArg::Char;
+			}
+			else if constexpr (GlxIsFloatingPoint<T>::Value)
+			{
+				return sizeof(T) == sizeof(GlxFloat) ? GlxEBinaryLogArg::Float : GlxEBinaryLogArg::Double;
+			}
+			else
+			{
+				return GetIntegerType<T>();
+			}
+		}
+
+	public:
+		static GLX_CONSTEXPR GlxEBinaryLogArg Type = GetType();
+
+		using StoredType = typename GlxTypeChooser<std::is_pointer_v<T>, GlxUInt64,
+			typename GlxTypeChooser<GlxIsFloatingPoint<T>::Value && sizeof(T) != sizeof(GlxFloat), GlxDouble, T>::Type>::Type;
+
+		static GLX_FORCE_INLINE GlxSizeT GetSize(const T&)
+		{
+			return sizeof(StoredType);
+		}
+
+		static GLX_FORCE_INLINE GlxUInt8* Write(GlxUInt8* OutDest, const T& InVal)
+		{
+			StoredType Val;
+
+			if constexpr (std::is_pointer_v<T>)
+			{
+				Val = static_cast<GlxUInt64>(reinterpret_cast<GlxSizeT>(InVal));
+			}
+			else
+			{
+				Val = static_cast<StoredType>(InVal);
+			}
+
+			GLX_MEMCPY(OutDest, &Val, sizeof(Val));
+			return OutDest + sizeof(Val);
+		}
+	};
+
+	class GlxBinaryLogStringTraits
+	{
+	public:
+		static GLX_CONSTEXPR GlxEBinaryLogArg Type = GlxEBinaryLogArg::String;
+
+		static GLX_FORCE_INLINE GlxSizeT GetSize(GlxStringView InStr)
+		{
+			return sizeof(GlxUInt32) + static_cast<GlxSizeT>(InStr.GetElementCount());
+		}
+
+		static GLX_FORCE_INLINE GlxUInt8* Write(GlxUInt8* OutDest, GlxStringView InStr)
+		{
+			const GlxUInt32 Length = static_cast<GlxUInt32>(InStr.GetElementCount());
+			GLX_MEMCPY(OutDest, &Length, sizeof(Length));
+			GLX_MEMCPY(OutDest + sizeof(Length), InStr.GetData(), Length);
+			return OutDest + sizeof(Length) + Length;
+		}
+	};
+
+	template<> class GlxBinaryLogArgTraits<const GlxChar*> : public GlxBinaryLogStringTraits {};
+	template<> class GlxBinaryLogArgTraits<GlxChar*> : public GlxBinaryLogStringTraits {};
+	template<> class GlxBinaryLogArgTraits<GlxString> : public GlxBinaryLogStringTraits {};
+	template<> class GlxBinaryLogArgTraits<GlxStringView> : public GlxBinaryLogStringTraits {};
+
+	template<typename... TArgs>
+	class GlxBinaryLogArgList
+	{
+	public:
+		// One extra element so that an empty list is still a valid array.
+		static GLX_CONSTEXPR GlxEBinaryLogArg Types[sizeof...(TArgs) + 1] = { GlxBinaryLogArgTraits<TArgs>::Type..., GlxEBinaryLogArg::Bool };
+	};
+
+	// The type GlxBinaryLog::DecodeRecord() hands to fmt for each stored kind, so formats can be checked against it
+	// at the call site.
+	template<GlxEBinaryLogArg InType>
+	class GlxBinaryLogFormatArg;
+
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Bool> { public: using Type = GlxBool; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Char> { public: using Type = GlxChar; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Int8> { public: using Type = GlxInt8; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Int16> { public: using Type = GlxInt16; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Int32> { public: using Type = GlxInt32; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Int64> { public: using Type = GlxInt64; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::UInt8> { public: using Type = GlxUInt8; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::UInt16> { public: using Type = GlxUInt16; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::UInt32> { public: using Type = GlxUInt32; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::UInt64> { public: using Type = GlxUInt64; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Float> { public: using Type = GlxFloat; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Double> { public: using Type = GlxDouble; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::Pointer> { public: using Type = const void*; };
+	template<> class GlxBinaryLogFormatArg<GlxEBinaryLogArg::String> { public: using Type = fmt::string_view; };
+
+	// Per-thread ring of binary records with a single producer (the owning thread) and a single consumer (the binary log
+	// flusher). Positions only ever grow; a record that would straddle the end of the ring is preceded by a padding
+	// record so every record is contiguous. Any record no larger than the ring is eventually written: the padding is
+	// published on its own as soon as its space is free, and an empty ring is simply restarted at offset 0.
+	class GlxBinaryLogBuffer : public GlxNonCopyable
+	{
+	public:
+		static GLX_CONSTEXPR GlxSizeT CacheLineSize = 64;
+
+		explicit GlxBinaryLogBuffer(GlxUInt64 InCapacity)
+			: Capacity(GlxBitUtils::RoundUpToPowerOfTwo(InCapacity)), Mask(Capacity - 1), Retired(false)
+		{
+			Data = static_cast<GlxUInt8*>(GLX_MALLOC(static_cast<GlxSizeT>(Capacity)));
+		}
+
+		~GlxBinaryLogBuffer()
+		{
+			GLX_FREE(Data);
+		}
+
+		GLX_FORCE_INLINE GlxUInt64 GetCapacity() const
+		{
+			return Capacity;
+		}
+
+		// Calls InFill(GlxUInt8*) with InSize contiguous bytes and publishes them. Returns false if the ring is full.
+		template<typename TFunc>
+		GLX_FORCE_INLINE GlxBool TryWrite(GlxUInt32 InSize, TFunc&& InFill)
+		{
+			GlxUInt64 Pos = WritePos.load(std::memory_order_relaxed);
+			const GlxUInt64 Offset = Pos & Mask;
+			GlxUInt64 Padding = Offset + InSize > Capacity ? Capacity - Offset : 0;
+			const GlxUInt64 End = Pos + Padding + InSize;
+
+			if (End - CachedReadPos > Capacity)
+			{
+				CachedReadPos = ReadPos.load(std::memory_order_acquire);
+
+				if (End - CachedReadPos > Capacity)
+				{
+					if (!Padding || !TryWritePadding(Pos, Padding) || InSize > Capacity)
+					{
+						return false;
+					}
+
+					// The ring was empty and now starts over at offset 0.
+					Pos += Padding;
+					Padding = 0;
+				}
+			}
+
+			if (Padding)
+			{
+				const GlxUInt32 PaddingHeader[2] = { 0, static_cast<GlxUInt32>(Padding) };
+				GLX_MEMCPY(Data + Offset, PaddingHeader, sizeof(PaddingHeader));
+			}
+
+			InFill(Data + ((Pos + Padding) & Mask));
+			WritePos.store(End, std::memory_order_release);
+			return true;
+		}
+
+		// Calls InFunc(const GlxUInt8*) for every published record and frees them. Returns the number of records read.
+		template<typename TFunc>
+		GlxInt64 Consume(TFunc&& InFunc)
+		{
+			// WritePos first: if it includes a restart by TryWritePadding, the ReadPos moved along with it is visible too.
+			const GlxUInt64 End = WritePos.load(std::memory_order_acquire);
+			const GlxUInt64 Start = ReadPos.load(std::memory_order_acquire);
+			GlxUInt64 Pos = Start;
+			GlxInt64 Count = 0;
+
+			while (Pos < End)
+			{
+				const GlxUInt8* Record = Data + (Pos & Mask);
+				GlxUInt32 Header[2];
+				GLX_MEMCPY(Header, Record, sizeof(Header));
+
+				if (Header[0] != 0)
+				{
+					InFunc(Record);
+					++Count;
+				}
+
+				Pos += Header[1];
+			}
+
+			// Only store if something was read; an empty ring's ReadPos may be moved by the producer.
+			if (Pos != Start)
+			{
+				ReadPos.store(Pos, std::memory_order_release);
+			}
+			return Count;
+		}
+
+		GLX_FORCE_INLINE GlxBool IsEmpty() const
+		{
+			return ReadPos.load(std::memory_order_acquire) == WritePos.load(std::memory_order_acquire);
+		}
+
+	private:
+		// Frees the tail of the ring that the record at InPos does not fit in, so the record can start at offset 0. Returns
+		// true if that made enough room to retry right away.
+		GlxBool TryWritePadding(GlxUInt64 InPos, GlxUInt64 InPadding)
+		{
+			// Nothing is queued, so the consumer has nothing to read and both positions can skip the tail. ReadPos goes
+			// first; Consume() loads WritePos before ReadPos and never sees ReadPos behind a restarted WritePos.
+			if (CachedReadPos == InPos)
+			{
+				CachedReadPos = InPos + InPadding;
+				ReadPos.store(CachedReadPos, std::memory_order_release);
+				WritePos.store(CachedReadPos, std::memory_order_release);
+				return true;
+			}
+
+			// Otherwise publish the padding by itself once its space is free; the record follows when the consumer has
+			// caught up with it.
+			if (InPos + InPadding - CachedReadPos <= Capacity)
+			{
+				const GlxUInt32 PaddingHeader[2] = { 0, static_cast<GlxUInt32>(InPadding) };
+				GLX_MEMCPY(Data + (InPos & Mask), PaddingHeader, sizeof(PaddingHeader));
+				WritePos.store(InPos + InPadding, std::memory_order_release);
+			}
+
+			return false;
+		}
+
+		GlxUInt8* Data;
+		const GlxUInt64 Capacity;
+		const GlxUInt64 Mask;
+
+	public:
+		// Set when the owning thread exits; the flusher frees the buffer once it has been drained.
+		GlxAtomic<GlxBool> Retired;
+
+	private:
+		alignas(CacheLineSize) GlxAtomic<GlxUInt64> WritePos{ 0 };
+		GlxUInt64 CachedReadPos = 0;
+		alignas(CacheLineSize) GlxAtomic<GlxUInt64> ReadPos{ 0 };
+	};
+}
+
+// Settings for GlxBinaryLog::Start().
+class GlxBinaryLogSettings
+{
+public:
+	// Size of each thread's ring in bytes; rounded up to a power of two. Takes effect for threads that log after Start().
+	GlxUInt64 BufferSize = 1 << 20;
+	// DropOldest behaves like DropNewest: only the flusher may free space in a thread's ring.
+	GlxELogOverflowPolicy OverflowPolicy = GlxELogOverflowPolicy::Block;
+	// How often the flusher looks for new records.
+	GlxInt32 FlushIntervalMilliseconds = 10;
+};
+
+// Deferred-formatting log. A call site registers its format string once and gets an ID; each call then only stores the
+// ID, a raw timestamp and the bytes of its arguments in the calling thread's ring, without formatting or locking. The
+// flusher thread started by Start() expands the records into the same text GlxLog produces and hands them to the
+// GlxLog callbacks. Records from one thread keep their order; records from different threads are not merged by time.
+// Arguments must be arithmetic, enums, pointers or narrow strings. Until Start() is called records are kept in the
+// rings (and dropped once a ring is full).
+class GLX_API GlxBinaryLog
+{
+public:
+	class GlxSite
+	{
+	public:
+		const GlxChar* Format;
+		const GlxChar* Category;
+		GlxELogLevel Level;
+		GlxUInt32 ArgCount;
+		const GlxEBinaryLogArg* ArgTypes;
+	};
+
+	static GLX_CONSTEXPR GlxUInt32 SitesPerBlock = 1u << 10;
+	static GLX_CONSTEXPR GlxUInt32 MaxSiteBlocks = 1u << 10;
+
+	// Use the GLX_BINARY_LOG_* macros; InFormatFunc is a lambda returning the format string, whose unique type gives
+	// every call site its own registration.
+	template<typename TLogProperties, GlxELogLevel InLevel, typename TFormatFunc, typename... TArgs>
+	static GLX_FORCE_INLINE void Log(const TLogProperties& InProperties, TFormatFunc InFormatFunc, const TArgs&... InArgs)
+	{
+		static_assert(InLevel >= GlxELogLevel::Debug && InLevel <= GlxELogLevel::Fatal);
+		static_assert(GlxIsBaseOf<GlxNsPrivate::GlxLogPropertiesBase, TLogProperties>::Value);
+
+		// Parsed against the argument types DecodeRecord() will use, so a bad format string fails to compile here instead
+		// of throwing on the flusher thread.
+		(void)fmt::format_string<typename GlxNsPrivate::GlxBinaryLogFormatArg<GlxNsPrivate::GlxBinaryLogArgTraits<typename GlxDecay<TArgs>::Type>::Type>::Type...>(TFormatFunc{}());
+
+		if (InProperties.IsLevelEnabled(InLevel))
+		{
+			static const GlxUInt32 SiteId = RegisterSite(GlxSite{
+				InFormatFunc(),
+				TLogProperties::Name,
+				InLevel,
+				static_cast<GlxUInt32>(sizeof...(TArgs)),
+				GlxNsPrivate::GlxBinaryLogArgList<typename GlxDecay<TArgs>::Type...>::Types });
+
+			// Every call from a site that did not fit in the table is dropped.
+			if (SiteId == 0)
+			{
+				DroppedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			else
+			{
+				Write<typename GlxDecay<TArgs>::Type...>(SiteId, InArgs...);
+			}
+		}
+
+		if constexpr (InLevel == GlxELogLevel::Fatal)
+		{
+			Flush();
+			GlxLog::Flush();
+			std::abort();
+		}
+	}
+
+	// Starts the flusher thread. Returns false if it is already running.
+	static GlxBool Start(const GlxBinaryLogSettings& InSettings = GlxBinaryLogSettings());
+
+	// Expands everything still buffered and stops the flusher thread.
+	static void Stop();
+
+	// Blocks until every record written before the call has been handed to the callbacks. Without a flusher thread the
+	// calling thread expands the records itself.
+	static void Flush();
+
+	static GlxBool IsRunning();
+
+	// Records discarded because a thread's ring was full, or because their call site could not be registered, over the
+	// life of the program.
+	static GlxUInt64 GetDroppedRecordCount();
+
+	static const GlxSite& GetSite(GlxUInt32 InSiteId);
+
+private:
+	using BufferType = GlxNsPrivate::GlxBinaryLogBuffer;
+
+	// Record layout: site ID (0 marks padding), total size, raw timestamp, then the arguments.
+	static GLX_CONSTEXPR GlxUInt32 HeaderSize = 2 * sizeof(GlxUInt32) + sizeof(GlxUInt64);
+	static GLX_CONSTEXPR GlxUInt32 RecordAlignment = 8;
+
+	class GlxClockSample
+	{
+	public:
+		GlxUInt64 Timestamp;
+		std::chrono::system_clock::time_point Time;
+	};
+
+	// Frees the calling thread's ring (once drained) when the thread exits.
+	class GlxThreadBufferOwner
+	{
+	public:
+		~GlxThreadBufferOwner()
+		{
+			if (Buffer)
+			{
+				Buffer->Retired.store(true, std::memory_order_release);
+			}
+		}
+
+		BufferType* Buffer = nullptr;
+	};
+
+	static GLX_FORCE_INLINE GlxUInt64 ReadTimestamp()
+	{
+	#if defined(GLX_CPU_ARCH_X86)
+		return __rdtsc();
+	#else
+		return static_cast<GlxUInt64>(std::chrono::steady_clock::now().time_since_epoch().count());
+	#endif
+	}
+
+	template<typename... TArgs>
+	static GLX_FORCE_INLINE void Write(GlxUInt32 InSiteId, const TArgs&... InArgs)
+	{
+		const GlxSizeT ArgsSize = (static_cast<GlxSizeT>(0) + ... + GlxNsPrivate::GlxBinaryLogArgTraits<TArgs>::GetSize(InArgs));
+		const GlxSizeT RecordSize = (HeaderSize + ArgsSize + RecordAlignment - 1) & ~static_cast<GlxSizeT>(RecordAlignment - 1);
+
+		BufferType* Buffer = ThreadBuffer.Buffer ? ThreadBuffer.Buffer : CreateThreadBuffer();
+
+		// Could never fit, whatever the flusher does.
+		if (RecordSize > Buffer->GetCapacity())
+		{
+			DroppedCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		const GlxUInt32 Size = static_cast<GlxUInt32>(RecordSize);
+		const GlxUInt64 Timestamp = ReadTimestamp();
+
+		const auto Fill = [&](GlxUInt8* OutDest)
+		{
+			const GlxUInt32 Header[2] = { InSiteId, Size };
+			GLX_MEMCPY(OutDest, Header, sizeof(Header));
+			GLX_MEMCPY(OutDest + sizeof(Header), &Timestamp, sizeof(Timestamp));
+			OutDest += HeaderSize;
+			((OutDest = GlxNsPrivate::GlxBinaryLogArgTraits<TArgs>::Write(OutDest, InArgs)), ...);
+		};
+
+		while (!Buffer->TryWrite(Size, Fill))
+		{
+			if (!HandleFullBuffer())
+			{
+				return;
+			}
+		}
+	}
+
+	// Returns 0 once all SitesPerBlock * MaxSiteBlocks IDs are taken.
+	static GlxUInt32 RegisterSite(const GlxSite& InSite);
+	static BufferType* CreateThreadBuffer();
+	static GlxBool HandleFullBuffer();
+	static GlxInt64 DrainBuffers();
+	static void DecodeRecord(const GlxUInt8* InRecord, const GlxClockSample& InNow, fmt::memory_buffer& OutText);
+	static void RunFlusher();
+
+	static GlxMutex SiteMutex;
+	static GlxSite* SiteBlocks[MaxSiteBlocks];
+	static GlxAtomic<GlxUInt32> SiteCount;
+
+	static GlxMutex BufferMutex;
+	static GlxDynamicArray<BufferType*> Buffers;
+	static thread_local GlxThreadBufferOwner ThreadBuffer;
+
+	static GlxBinaryLogSettings Settings;
+	static GlxThread* FlusherThread;
+	static GlxAtomic<GlxBool> Running;
+	static GlxAtomic<GlxBool> StopRequested;
+	static GlxAtomic<GlxUInt64> DroppedCount;
+
+	static GlxMutex DrainMutex;
+	static GlxMutex FlushMutex;
+	static GlxConditionVariable FlusherCondition;
+	static GlxConditionVariable FlushedCondition;
+	static GlxAtomic<GlxUInt64> FlushRequested;
+	static GlxAtomic<GlxUInt64> FlushCompleted;
+
+	// Raw timestamps are turned into wall-clock time by interpolating between this pair and one taken when decoding.
+	static const GlxUInt64 StartTimestamp;
+	static const std::chrono::system_clock::time_point StartTime;
+};
+
+GlxMutex GlxBinaryLog::SiteMutex;
+GlxBinaryLog::GlxSite* GlxBinaryLog::SiteBlocks[GlxBinaryLog::MaxSiteBlocks] = {};
+GlxAtomic<GlxUInt32> GlxBinaryLog::SiteCount{ 0 };
+
+GlxMutex GlxBinaryLog::BufferMutex;
+GlxDynamicArray<GlxBinaryLog::BufferType*> GlxBinaryLog::Buffers;
+thread_local GlxBinaryLog::GlxThreadBufferOwner GlxBinaryLog::ThreadBuffer;
+
+GlxBinaryLogSettings GlxBinaryLog::Settings;
+GlxThread* GlxBinaryLog::FlusherThread = nullptr;
+GlxAtomic<GlxBool> GlxBinaryLog::Running{ false };
+GlxAtomic<GlxBool> GlxBinaryLog::StopRequested{ false };
+GlxAtomic<GlxUInt64> GlxBinaryLog::DroppedCount{ 0 };
+
+GlxMutex GlxBinaryLog::DrainMutex;
+GlxMutex GlxBinaryLog::FlushMutex;
+GlxConditionVariable GlxBinaryLog::FlusherCondition;
+GlxConditionVariable GlxBinaryLog::FlushedCondition;
+GlxAtomic<GlxUInt64> GlxBinaryLog::FlushRequested{ 0 };
+GlxAtomic<GlxUInt64> GlxBinaryLog::FlushCompleted{ 0 };
+
+const GlxUInt64 GlxBinaryLog::StartTimestamp = GlxBinaryLog::ReadTimestamp();
+const std::chrono::system_clock::time_point GlxBinaryLog::StartTime = std::chrono::system_clock::now();
+
+GlxUInt32 GlxBinaryLog::RegisterSite(const GlxSite& InSite)
+{
+	GlxScopedLock<GlxMutex> Lock{ SiteMutex };
+
+	// ID 0 marks padding, so IDs start at 1.
+	const GlxUInt32 Id = SiteCount.load(std::memory_order_relaxed) + 1;
+
+	if (Id >= SitesPerBlock * MaxSiteBlocks)
+	{
+		return 0;
+	}
+
+	GlxSite*& Block = SiteBlocks[Id / SitesPerBlock];
+
+	if (!Block)
+	{
+		Block = static_cast<GlxSite*>(GLX_MALLOC(SitesPerBlock * sizeof(GlxSite)));
+	}
+
+	Block[Id % SitesPerBlock] = InSite;
+	SiteCount.store(Id, std::memory_order_release);
+	return Id;
+}
+
+const GlxBinaryLog::GlxSite& GlxBinaryLog::GetSite(GlxUInt32 InSiteId)
+{
+	GLX_ASSERT(InSiteId > 0 && InSiteId <= SiteCount.load(std::memory_order_acquire));
+	return SiteBlocks[InSiteId / SitesPerBlock][InSiteId % SitesPerBlock];
+}
+
+GlxBinaryLog::BufferType* GlxBinaryLog::CreateThreadBuffer()
+{
+	BufferType* Buffer = new BufferType(Settings.BufferSize);
+
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+	Buffers.EmplaceBack(Buffer);
+	ThreadBuffer.Buffer = Buffer;
+	return Buffer;
+}
+
+GlxBool GlxBinaryLog::HandleFullBuffer()
+{
+	// Blocking only makes sense if a flusher is there to make room. Write() has already dropped records larger than the
+	// ring, so every record that gets here fits once the flusher has caught up.
+	if (!Running.load(std::memory_order_acquire) || Settings.OverflowPolicy != GlxELogOverflowPolicy::Block)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	GlxThreadUtils::YieldThisThread();
+	return true;
+}
+
+void GlxBinaryLog::DecodeRecord(const GlxUInt8* InRecord, const GlxClockSample& InNow, fmt::memory_buffer& OutText)
+{
+	GlxUInt32 Header[2];
+	GlxUInt64 Timestamp;
+	GLX_MEMCPY(Header, InRecord, sizeof(Header));
+	GLX_MEMCPY(&Timestamp, InRecord + sizeof(Header), sizeof(Timestamp));
+
+	const GlxSite& Site = GetSite(Header[0]);
+	const GlxUInt8* Args = InRecord + HeaderSize;
+
+	// Interpolating between two (timestamp, time) pairs works for any monotonic counter without knowing its frequency.
+	const GlxDouble Elapsed = static_cast<GlxDouble>(static_cast<GlxInt64>(InNow.Timestamp - StartTimestamp));
+	const GlxDouble Fraction = Elapsed > 0.0 ? static_cast<GlxDouble>(static_cast<GlxInt64>(Timestamp - StartTimestamp)) / Elapsed : 0.0;
+	const std::chrono::system_clock::time_point Time = StartTime + std::chrono::duration_cast<std::chrono::system_clock::duration>((InNow.Time - StartTime) * Fraction);
+
+	fmt::dynamic_format_arg_store<fmt::format_context> Store;
+	Store.reserve(Site.ArgCount, 0);
+
+	for (GlxUInt32 Index = 0; Index < Site.ArgCount; ++Index)
+	{
+		const auto Read = [&Args](auto InVal)
+		{
+			GLX_MEMCPY(&InVal, Args, sizeof(InVal));
+			Args += sizeof(InVal);
+			return InVal;
+		};
+
+		switch (Site.ArgTypes[Index])
+		{
+			case GlxEBinaryLogArg::Bool: Store.push_back(Read(GlxBool())); break;
+			case GlxEBinaryLogArg::Char: Store.push_back(Read(GlxChar())); break;
+			case GlxEBinaryLogArg::Int8: Store.push_back(Read(GlxInt8())); break;
+			case GlxEBinaryLogArg::Int16: Store.push_back(Read(GlxInt16())); break;
+			case GlxEBinaryLogArg::Int32: Store.push_back(Read(GlxInt32())); break;
+			case GlxEBinaryLogArg::Int64: Store.push_back(Read(GlxInt64())); break;
+			case GlxEBinaryLogArg::UInt8: Store.push_back(Read(GlxUInt8())); break;
+			case GlxEBinaryLogArg::UInt16: Store.push_back(Read(GlxUInt16())); break;
+			case GlxEBinaryLogArg::UInt32: Store.push_back(Read(GlxUInt32())); break;
+			case GlxEBinaryLogArg::UInt64: Store.push_back(Read(GlxUInt64())); break;
+			case GlxEBinaryLogArg::Float: Store.push_back(Read(GlxFloat())); break;
+			case GlxEBinaryLogArg::Double: Store.push_back(Read(GlxDouble())); break;
+			case GlxEBinaryLogArg::Pointer: Store.push_back(reinterpret_cast<const void*>(static_cast<GlxSizeT>(Read(GlxUInt64())))); break;
+			case GlxEBinaryLogArg::String:
+			{
+				const GlxUInt32 Length = Read(GlxUInt32());
+				Store.push_back(fmt::string_view(reinterpret_cast<const GlxChar*>(Args), Length));
+				Args += Length;
+				break;
+			}
+		}
+	}
+
+	fmt::format_to(fmt::appender(OutText), "[{:%Y-%m-%d %H:%M:%S}] [{}] {}: ", Time, Site.Category, GlxLog::LogLevelToCString[static_cast<GlxInt32>(Site.Level)]);
+	fmt::vformat_to(fmt::appender(OutText), fmt::string_view(Site.Format), Store);
+	OutText.push_back('\n');
+	OutText.push_back('\0');
+}
+
+GlxInt64 GlxBinaryLog::DrainBuffers()
+{
+	// Only one thread expands records at a time, so every ring keeps a single consumer.
+	GlxScopedLock<GlxMutex> DrainLock{ DrainMutex };
+
+	static GlxDynamicArray<BufferType*> Snapshot;
+	{
+		GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+		Snapshot = Buffers;
+	}
+
+	const GlxClockSample Now{ ReadTimestamp(), std::chrono::system_clock::now() };
+	fmt::memory_buffer Text;
+	GlxInt64 Count = 0;
+
+	for (BufferType* Buffer : Snapshot)
+	{
+		const GlxBool Retired = Buffer->Retired.load(std::memory_order_acquire);
+
+		Count += Buffer->Consume([&Text, &Now](const GlxUInt8* InRecord)
+		{
+			Text.clear();
+			DecodeRecord(InRecord, Now, Text);
+
+			GlxLogRecord Record{};
+			Record.Data = Text.data();
+			Record.DataLength = Text.size() - 1;
+			Record.Level = GetSite(*reinterpret_cast<const GlxUInt32*>(InRecord)).Level;
+			Record.CharType = GlxECharType::Char;
+
+			GlxLog::DispatchRecord(Record);
+		});
+
+		// The owner wrote its last record before retiring, so the ring is now empty for good.
+		if (Retired)
+		{
+			GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+			Buffers.Remove(Buffer);
+			delete Buffer;
+		}
+	}
+
+	return Count;
+}
+
+void GlxBinaryLog::RunFlusher()
+{
+	while (true)
+	{
+		const GlxUInt64 Request = FlushRequested.load(std::memory_order_acquire);
+		const GlxInt64 Count = DrainBuffers();
+
+		FlushMutex.Lock();
+
+		// Every ring was drained past what it held when Request was made.
+		FlushCompleted.store(Request, std::memory_order_release);
+		FlushedCondition.NotifyAll();
+
+		if (Count == 0 && StopRequested.load(std::memory_order_acquire))
+		{
+			FlushMutex.Unlock();
+			break;
+		}
+
+		if (Count == 0 && FlushRequested.load(std::memory_order_acquire) == Request)
+		{
+			FlusherCondition.WaitFor(FlushMutex, Settings.FlushIntervalMilliseconds);
+		}
+
+		FlushMutex.Unlock();
+	}
+}
+
+GlxBool GlxBinaryLog::Start(const GlxBinaryLogSettings& InSettings)
+{
+	if (Running.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	Settings = InSettings;
+	StopRequested.store(false, std::memory_order_relaxed);
+	FlusherThread = new GlxThread(&GlxBinaryLog::RunFlusher);
+	Running.store(true, std::memory_order_release);
+	return true;
+}
+
+void GlxBinaryLog::Stop()
+{
+	if (!Running.exchange(false, std::memory_order_acq_rel))
+	{
+		return;
+	}
+
+	StopRequested.store(true, std::memory_order_release);
+
+	FlushMutex.Lock();
+	FlusherCondition.NotifyOne();
+	FlushMutex.Unlock();
+
+	FlusherThread->Join();
+	delete FlusherThread;
+	FlusherThread = nullptr;
+}
+
+void GlxBinaryLog::Flush()
+{
+	if (!Running.load(std::memory_order_acquire))
+	{
+		DrainBuffers();
+		return;
+	}
+
+	GlxScopedLock<GlxMutex> Lock{ FlushMutex };
+
+	const GlxUInt64 Target = FlushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+	while (FlushCompleted.load(std::memory_order_acquire) < Target)
+	{
+		FlusherCondition.NotifyOne();
+		FlushedCondition.WaitFor(FlushMutex, Settings.FlushIntervalMilliseconds);
+	}
+}
+
+GlxBool GlxBinaryLog::IsRunning()
+{
+	return Running.load(std::memory_order_acquire);
+}
+
+GlxUInt64 GlxBinaryLog::GetDroppedRecordCount()
+{
+	return DroppedCount.load(std::memory_order_relaxed);
+}
+
+#if !defined(GLX_BINARY_LOG_DEBUG)
+	#define GLX_BINARY_LOG_DEBUG(InProperties, InFormat, ...)                                                                                                                                        \
+		do                                                                                                                                                                                           \
+		{                                                                                                                                                                                            \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Debug)                                                                                                                              \
+			{                                                                                                                                                                                        \
+				GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Debug>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__); \
+			}                                                                                                                                                                                        \
+		} while (false)
+#endif
+
+#if !defined(GLX_BINARY_LOG_INFO)
+	#define GLX_BINARY_LOG_INFO(InProperties, InFormat, ...)                                                                                                                                        \
+		do                                                                                                                                                                                          \
+		{                                                                                                                                                                                           \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Info)                                                                                                                              \
+			{                                                                                                                                                                                       \
+				GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Info>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__); \
+			}                                                                                                                                                                                       \
+		} while (false)
+#endif
+
+#if !defined(GLX_BINARY_LOG_SUCCESS)
+	#define GLX_BINARY_LOG_SUCCESS(InProperties, InFormat, ...)                                                                                                                                        \
+		do                                                                                                                                                                                             \
+		{                                                                                                                                                                                              \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Success)                                                                                                                              \
+			{                                                                                                                                                                                          \
+				GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Success>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__); \
+			}                                                                                                                                                                                          \
+		} while (false)
+#endif
+
+#if !defined(GLX_BINARY_LOG_WARNING)
+	#define GLX_BINARY_LOG_WARNING(InProperties, InFormat, ...)                                                                                                                                        \
+		do                                                                                                                                                                                             \
+		{                                                                                                                                                                                              \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Warning)                                                                                                                              \
+			{                                                                                                                                                                                          \
+				GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Warning>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__); \
+			}                                                                                                                                                                                          \
+		} while (false)
+#endif
+
+#if !defined(GLX_BINARY_LOG_ERROR)
+	#define GLX_BINARY_LOG_ERROR(InProperties, InFormat, ...)                                                                                                                                        \
+		do                                                                                                                                                                                           \
+		{                                                                                                                                                                                            \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Error)                                                                                                                              \
+			{                                                                                                                                                                                        \
+				GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Error>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__); \
+			}                                                                                                                                                                                        \
+		} while (false)
+#endif
+
+#if !defined(GLX_BINARY_LOG_FATAL)
+	#define GLX_BINARY_LOG_FATAL(InProperties, InFormat, ...) GlxBinaryLog::Log<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), GlxELogLevel::Fatal>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), [] { return InFormat; }, ##__VA_ARGS__)
+#endif
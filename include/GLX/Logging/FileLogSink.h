@@ -0,0 +1,653 @@
+#pragma once
+
+#include "Log.h"
+
+#include "GLX/FileSystem/Path.h"
+#include "GLX/FileSystem/FileSystem.h"
+#include "GLX/Containers/DynamicArray.h"
+#include "GLX/Utils/Gzip.h"
+
+#include "GLX/ThirdParty/fmt/chrono.h"
+
+#include <cstdio>
+#include <algorithm>
+
+#if defined(GLX_PLATFORM_WINDOWS)
+	#include <io.h>
+#else
+	#include <unistd.h>
+#endif
+
+// When GlxFileLogSink forces written data to disk.
+enum class GlxELogFsyncPolicy : GlxInt8
+{
+	Never,      // Leave it to the OS.
+	Periodic,   // After a write, if FsyncIntervalMilliseconds have passed since the last sync.
+	EveryWrite, // After every batch.
+};
+
+// Settings for GlxFileLogSink::Open().
+class GlxFileLogSinkSettings
+{
+public:
+	// The active file; finished segments are renamed next to it as <stem>.<yyyymmdd-hhmmss>[_<nnnnnn>]<extension>, the
+	// counter telling apart segments finished within the same second.
+	GlxPath FilePath = "GLX.log";
+	// Size of each of the two write buffers. Callers only wait for the writer when the one being filled is full.
+	GlxInt64 BufferSize = 1 << 20;
+	// Longest a record stays buffered before the writer thread writes it out.
+	GlxInt32 FlushIntervalMilliseconds = 200;
+	// Records at or above this level are written (and synced, unless the policy is Never) before the log call
+	// returns. Fatal records always are.
+	GlxELogLevel FlushLevel = GlxELogLevel::Error;
+	// Start a new segment once the file reaches this many bytes; 0 disables.
+	GlxInt64 MaxFileSize = 64ll << 20;
+	// Start a new segment after this many seconds; 0 disables.
+	GlxInt64 RotationIntervalSeconds = 0;
+	// gzip finished segments on a background thread.
+	GlxBool CompressRotatedFiles = true;
+	// Finished segments to keep, oldest deleted first; 0 keeps all of them.
+	GlxInt32 MaxRetainedFiles = 0;
+	GlxELogFsyncPolicy FsyncPolicy = GlxELogFsyncPolicy::Periodic;
+	GlxInt32 FsyncIntervalMilliseconds = 1000;
+};
+
+// Log callback that writes records to a file. Callers copy the text into a large buffer; a writer thread swaps it for
+// an empty one and writes the whole batch with a single unbuffered write, so disk latency never reaches the logging
+// threads unless the buffer fills up. Segments are rotated by size or time, and compression and clean-up of old
+// segments run on a thread of their own. Wide records are written as UTF-8.
+class GLX_API GlxFileLogSink
+{
+public:
+	// Opens InSettings.FilePath for appending, starts the background threads and registers the callback with GlxLog.
+	// Returns false if the sink is already open or the file cannot be opened.
+	static GlxBool Open(const GlxFileLogSinkSettings& InSettings = GlxFileLogSinkSettings());
+
+	// Delivers the records still queued by GlxLog's async mode, unregisters the callback, writes everything buffered,
+	// waits for pending compression and closes the file.
+	static void Close();
+
+	// Blocks until every record handed to the sink before the call is written (and synced, unless the policy is
+	// Never).
+	static void Flush();
+
+	static GlxBool IsOpen();
+
+	// Bytes written to the log files since Open().
+	static GlxUInt64 GetWrittenByteCount();
+
+	// Writes that failed since Open(); their records are lost.
+	static GlxUInt64 GetWriteErrorCount();
+
+	// The GlxLogCallback registered by Open().
+	static void LogCallback(const GlxLogRecord& InRecord);
+
+private:
+	using BufferType = fmt::memory_buffer;
+
+	static std::FILE* OpenFile(const GlxPath& InPath);
+	static void SyncFile(std::FILE* InFile);
+	static void RequestWrite(GlxBool InSync);
+	// Must be called with BufferMutex held.
+	static void WaitUntilWritten(GlxUInt64 InTarget);
+	static void WriteBatch(const BufferType& InBatch, GlxBool InSync);
+	static void RotateIfNeeded(std::chrono::steady_clock::time_point InNow);
+	static void Rotate();
+	static GlxPath MakeSegmentPath();
+	static GlxBool IsSegmentName(const std::string& InName, const std::string& InStem, const std::string& InExtension);
+	static void RemoveOldSegments();
+	static void RunWriter();
+	static void RunCompressor();
+
+	static GlxFileLogSinkSettings Settings;
+
+	// Guards both buffers, the byte counters and the request flags.
+	static GlxMutex BufferMutex;
+	static GlxConditionVariable WriterCondition;
+	static GlxConditionVariable WrittenCondition;
+	static BufferType Buffers[2];
+	static BufferType* FrontBuffer;
+	static GlxUInt64 BufferedBytes;
+	static GlxUInt64 WrittenBytes;
+	static GlxBool WriteRequested;
+	static GlxBool SyncRequested;
+	static GlxBool StopRequested;
+	static GlxBool Opened;
+
+	// Only touched by the writer thread while the sink is open.
+	static std::FILE* File;
+	static GlxInt64 FileSize;
+	static std::chrono::steady_clock::time_point SegmentStartTime;
+	static std::chrono::steady_clock::time_point LastSyncTime;
+	static GlxString LastSegmentTime;
+	static GlxInt32 LastSegmentIndex;
+
+	static GlxMutex CompressMutex;
+	static GlxConditionVariable CompressCondition;
+	static GlxDynamicArray<GlxPath> PendingSegments;
+	static GlxBool CompressorStopRequested;
+
+	static GlxThread* WriterThread;
+	static GlxThread* CompressorThread;
+	static GlxAtomic<GlxUInt64> WriteErrorCount;
+};
+
+GlxFileLogSinkSettings GlxFileLogSink::Settings;
+
+GlxMutex GlxFileLogSink::BufferMutex;
+GlxConditionVariable GlxFileLogSink::WriterCondition;
+GlxConditionVariable GlxFileLogSink::WrittenCondition;
+GlxFileLogSink::BufferType GlxFileLogSink::Buffers[2];
+GlxFileLogSink::BufferType* GlxFileLogSink::FrontBuffer = &GlxFileLogSink::Buffers[0];
+GlxUInt64 GlxFileLogSink::BufferedBytes = 0;
+GlxUInt64 GlxFileLogSink::WrittenBytes = 0;
+GlxBool GlxFileLogSink::WriteRequested = false;
+GlxBool GlxFileLogSink::SyncRequested = false;
+GlxBool GlxFileLogSink::StopRequested = false;
+GlxBool GlxFileLogSink::Opened = false;
+
+std::FILE* GlxFileLogSink::File = nullptr;
+GlxInt64 GlxFileLogSink::FileSize = 0;
+std::chrono::steady_clock::time_point GlxFileLogSink::SegmentStartTime;
+std::chrono::steady_clock::time_point GlxFileLogSink::LastSyncTime;
+GlxString GlxFileLogSink::LastSegmentTime;
+GlxInt32 GlxFileLogSink::LastSegmentIndex = 0;
+
+GlxMutex GlxFileLogSink::CompressMutex;
+GlxConditionVariable GlxFileLogSink::CompressCondition;
+GlxDynamicArray<GlxPath> GlxFileLogSink::PendingSegments;
+GlxBool GlxFileLogSink::CompressorStopRequested = false;
+
+GlxThread* GlxFileLogSink::WriterThread = nullptr;
+GlxThread* GlxFileLogSink::CompressorThread = nullptr;
+GlxAtomic<GlxUInt64> GlxFileLogSink::WriteErrorCount{ 0 };
+
+GlxBool GlxFileLogSink::Open(const GlxFileLogSinkSettings& InSettings)
+{
+	{
+		GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+
+		if (Opened)
+		{
+			return false;
+		}
+
+		File = OpenFile(InSettings.FilePath);
+
+		if (!File)
+		{
+			return false;
+		}
+
+		Settings = InSettings;
+		Opened = true;
+		StopRequested = false;
+		WriteRequested = false;
+		SyncRequested = false;
+		BufferedBytes = 0;
+		WrittenBytes = 0;
+
+		for (BufferType& Buffer : Buffers)
+		{
+			Buffer.clear();
+			Buffer.reserve(static_cast<GlxSizeT>(InSettings.BufferSize));
+		}
+	}
+
+	std::fseek(File, 0, SEEK_END);
+	FileSize = static_cast<GlxInt64>(std::ftell(File));
+	SegmentStartTime = std::chrono::steady_clock::now();
+	LastSyncTime = SegmentStartTime;
+	WriteErrorCount.store(0, std::memory_order_relaxed);
+
+	CompressorStopRequested = false;
+	WriterThread = new GlxThread(&GlxFileLogSink::RunWriter);
+	CompressorThread = new GlxThread(&GlxFileLogSink::RunCompressor);
+
+	GlxLog::AddLogCallback(&GlxFileLogSink::LogCallback);
+	return true;
+}
+
+void GlxFileLogSink::Close()
+{
+	// In async mode, records logged before this call may still be waiting in GlxLog's queue.
+	GlxLog::Flush();
+	GlxLog::RemoveLogCallback(&GlxFileLogSink::LogCallback);
+
+	{
+		GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+
+		if (!Opened || StopRequested)
+		{
+			return;
+		}
+
+		// The writer empties the buffers before it exits.
+		StopRequested = true;
+		SyncRequested = true;
+		WriteRequested = true;
+		WriterCondition.NotifyOne();
+	}
+
+	WriterThread->Join();
+	delete WriterThread;
+	WriterThread = nullptr;
+
+	CompressMutex.Lock();
+	CompressorStopRequested = true;
+	CompressCondition.NotifyOne();
+	CompressMutex.Unlock();
+
+	CompressorThread->Join();
+	delete CompressorThread;
+	CompressorThread = nullptr;
+
+	std::fclose(File);
+	File = nullptr;
+
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+	Opened = false;
+}
+
+void GlxFileLogSink::Flush()
+{
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+
+	if (Opened && !StopRequested)
+	{
+		RequestWrite(true);
+		WaitUntilWritten(BufferedBytes);
+	}
+}
+
+GlxBool GlxFileLogSink::IsOpen()
+{
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+	return Opened;
+}
+
+GlxUInt64 GlxFileLogSink::GetWrittenByteCount()
+{
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+	return WrittenBytes;
+}
+
+GlxUInt64 GlxFileLogSink::GetWriteErrorCount()
+{
+	return WriteErrorCount.load(std::memory_order_relaxed);
+}
+
+void GlxFileLogSink::LogCallback(const GlxLogRecord& InRecord)
+{
+	const GlxChar* Data = static_cast<const GlxChar*>(InRecord.Data);
+	GlxSizeT Size = InRecord.DataLength;
+
+	// Converted outside the lock so other threads are not held up.
+	static thread_local BufferType Utf8Buffer;
+
+	if (InRecord.CharType == GlxECharType::WChar)
+	{
+		Utf8Buffer.clear();
+		fmt::detail::to_utf8<GlxWChar>::convert(
+			Utf8Buffer, fmt::basic_string_view<GlxWChar>(static_cast<const GlxWChar*>(InRecord.Data), InRecord.DataLength), fmt::detail::to_utf8_error_policy::replace);
+		Data = Utf8Buffer.data();
+		Size = Utf8Buffer.size();
+	}
+
+	GlxScopedLock<GlxMutex> Lock{ BufferMutex };
+
+	if (!Opened || StopRequested)
+	{
+		return;
+	}
+
+	const GlxSizeT Capacity = static_cast<GlxSizeT>(Settings.BufferSize);
+
+	// Only the swap is waited for, not the write. A record larger than a whole buffer goes into an empty one.
+	while (FrontBuffer->size() > 0 && FrontBuffer->size() + Size > Capacity)
+	{
+		RequestWrite(false);
+		WrittenCondition.Wait(BufferMutex);
+
+		if (StopRequested)
+		{
+			return;
+		}
+	}
+
+	FrontBuffer->append(Data, Data + Size);
+	BufferedBytes += Size;
+
+	if (InRecord.Level == GlxELogLevel::Fatal || GlxNsPrivate::GlxLogPropertiesBase::PassesLevel(InRecord.Level, Settings.FlushLevel))
+	{
+		RequestWrite(true);
+		WaitUntilWritten(BufferedBytes);
+	}
+	else if (FrontBuffer->size() >= Capacity)
+	{
+		RequestWrite(false);
+	}
+}
+
+std::FILE* GlxFileLogSink::OpenFile(const GlxPath& InPath)
+{
+#if defined(GLX_PLATFORM_WINDOWS)
+	std::FILE* NewFile = _wfopen(InPath.c_str(), L"ab");
+#else
+	std::FILE* NewFile = std::fopen(InPath.c_str(), "ab");
+#endif
+
+	// Unbuffered, so each batch goes to the OS as one write.
+	if (NewFile)
+	{
+		std::setvbuf(NewFile, nullptr, _IONBF, 0);
+	}
+
+	return NewFile;
+}
+
+void GlxFileLogSink::SyncFile(std::FILE* InFile)
+{
+#if defined(GLX_PLATFORM_WINDOWS)
+	_commit(_fileno(InFile));
+#else
+	fsync(fileno(InFile));
+#endif
+}
+
+void GlxFileLogSink::RequestWrite(GlxBool InSync)
+{
+	WriteRequested = true;
+	SyncRequested = SyncRequested || InSync;
+	WriterCondition.NotifyOne();
+}
+
+void GlxFileLogSink::WaitUntilWritten(GlxUInt64 InTarget)
+{
+	while (WrittenBytes < InTarget && !StopRequested)
+	{
+		WrittenCondition.Wait(BufferMutex);
+	}
+}
+
+void GlxFileLogSink::WriteBatch(const BufferType& InBatch, GlxBool InSync)
+{
+	if (InBatch.size() > 0)
+	{
+		if (std::fwrite(InBatch.data(), 1, InBatch.size(), File) == InBatch.size())
+		{
+			FileSize += static_cast<GlxInt64>(InBatch.size());
+		}
+		else
+		{
+			WriteErrorCount.fetch_add(1, std::memory_order_relaxed);
+			std::clearerr(File);
+		}
+	}
+
+	const std::chrono::steady_clock::time_point Now = std::chrono::steady_clock::now();
+	const GlxBool SyncDue = Settings.FsyncPolicy == GlxELogFsyncPolicy::EveryWrite ||
+		(Settings.FsyncPolicy == GlxELogFsyncPolicy::Periodic &&
+			Now - LastSyncTime >= std::chrono::milliseconds(Settings.FsyncIntervalMilliseconds));
+
+	if (Settings.FsyncPolicy != GlxELogFsyncPolicy::Never && (InSync || (SyncDue && InBatch.size() > 0)))
+	{
+		SyncFile(File);
+		LastSyncTime = Now;
+	}
+
+	RotateIfNeeded(Now);
+}
+
+void GlxFileLogSink::RotateIfNeeded(std::chrono::steady_clock::time_point InNow)
+{
+	if (FileSize == 0)
+	{
+		return;
+	}
+
+	if ((Settings.MaxFileSize > 0 && FileSize >= Settings.MaxFileSize) ||
+		(Settings.RotationIntervalSeconds > 0 && InNow - SegmentStartTime >= std::chrono::seconds(Settings.RotationIntervalSeconds)))
+	{
+		Rotate();
+	}
+}
+
+void GlxFileLogSink::Rotate()
+{
+	if (Settings.FsyncPolicy != GlxELogFsyncPolicy::Never)
+	{
+		SyncFile(File);
+	}
+
+	std::fclose(File);
+
+	const GlxPath SegmentPath = MakeSegmentPath();
+	std::error_code Error;
+	std::filesystem::rename(Settings.FilePath, SegmentPath, Error);
+
+	File = OpenFile(Settings.FilePath);
+
+	// Without a file there is nowhere to write; keep appending to the old one instead of losing records.
+	if (!Error && !File)
+	{
+		std::filesystem::rename(SegmentPath, Settings.FilePath, Error);
+		File = OpenFile(Settings.FilePath);
+		Error = std::make_error_code(std::errc::io_error);
+		WriteErrorCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Nothing was rotated, so the active file still holds everything written so far.
+	if (Error)
+	{
+		if (File && std::fseek(File, 0, SEEK_END) == 0)
+		{
+			FileSize = static_cast<GlxInt64>(std::ftell(File));
+		}
+
+		return;
+	}
+
+	FileSize = 0;
+	SegmentStartTime = std::chrono::steady_clock::now();
+
+	CompressMutex.Lock();
+	PendingSegments.EmplaceBack(SegmentPath);
+	CompressCondition.NotifyOne();
+	CompressMutex.Unlock();
+}
+
+GlxPath GlxFileLogSink::MakeSegmentPath()
+{
+	const GlxPath Stem = Settings.FilePath.stem();
+	const GlxPath Extension = Settings.FilePath.extension();
+	const GlxString Time = fmt::format("{:%Y%m%d-%H%M%S}", std::chrono::time_point_cast<std::chrono::seconds>(std::chrono::system_clock::now())).c_str();
+
+	// Names sort by time. Within a second the counter only goes up, even past names that retention has deleted, and is
+	// zero-padded so it sorts as text; no suffix sorts first since '.' comes before '_'.
+	GlxInt32 Index = Time == LastSegmentTime ? LastSegmentIndex + 1 : 0;
+
+	for (;; ++Index)
+	{
+		GlxPath Name = Stem;
+		Name += ".";
+		Name += Time.GetData();
+
+		if (Index > 0)
+		{
+			Name += fmt::format("_{:06}", Index).c_str();
+		}
+
+		Name += Extension;
+
+		GlxPath Path = Settings.FilePath.parent_path() / Name;
+		GlxPath Compressed = Path;
+		Compressed += ".gz";
+
+		if (!GlxFileSystem::Exists(Path) && !GlxFileSystem::Exists(Compressed))
+		{
+			LastSegmentTime = Time;
+			LastSegmentIndex = Index;
+			return Path;
+		}
+	}
+}
+
+GlxBool GlxFileLogSink::IsSegmentName(const std::string& InName, const std::string& InStem, const std::string& InExtension)
+{
+	// Only <stem>.<yyyymmdd-hhmmss>[_<nnnnnn>]<extension>[.gz], as made by MakeSegmentPath(); anything else next to the
+	// active file belongs to someone else.
+	const auto IsDigits = [&InName](GlxSizeT InPos, GlxSizeT InCount)
+	{
+		return std::all_of(InName.begin() + InPos, InName.begin() + InPos + InCount, [](char InChar) { return InChar >= '0' && InChar <= '9'; });
+	};
+
+	GlxSizeT Length = InName.size();
+
+	if (Length > 3 && InName.compare(Length - 3, 3, ".gz") == 0)
+	{
+		Length -= 3;
+	}
+
+	if (Length < InExtension.size() || InName.compare(Length - InExtension.size(), InExtension.size(), InExtension) != 0)
+	{
+		return false;
+	}
+
+	Length -= InExtension.size();
+
+	const GlxSizeT TimePos = InStem.size() + 1;
+	const GlxSizeT TimeLength = 15;
+
+	if (Length < TimePos + TimeLength || InName.compare(0, InStem.size(), InStem) != 0 || InName[InStem.size()] != '.' ||
+		!IsDigits(TimePos, 8) || InName[TimePos + 8] != '-' || !IsDigits(TimePos + 9, 6))
+	{
+		return false;
+	}
+
+	const GlxSizeT SuffixLength = Length - TimePos - TimeLength;
+	return SuffixLength == 0 || (SuffixLength == 7 && InName[TimePos + TimeLength] == '_' && IsDigits(TimePos + TimeLength + 1, 6));
+}
+
+void GlxFileLogSink::RemoveOldSegments()
+{
+	if (Settings.MaxRetainedFiles <= 0)
+	{
+		return;
+	}
+
+	const GlxPath Directory = Settings.FilePath.parent_path().empty() ? GlxPath(".") : Settings.FilePath.parent_path();
+	const std::string Stem = Settings.FilePath.stem().string();
+	const std::string Extension = Settings.FilePath.extension().string();
+
+	GlxDynamicArray<std::string> Segments;
+	std::error_code Error;
+
+	for (const auto& Entry : std::filesystem::directory_iterator{ Directory, Error })
+	{
+		std::string Name = Entry.path().filename().string();
+
+		if (IsSegmentName(Name, Stem, Extension))
+		{
+			Segments.EmplaceBack(Move(Name));
+		}
+	}
+
+	if (Segments.GetElementCount() <= Settings.MaxRetainedFiles)
+	{
+		return;
+	}
+
+	std::sort(Segments.begin(), Segments.end());
+
+	for (GlxInt64 Index = 0; Index < Segments.GetElementCount() - Settings.MaxRetainedFiles; ++Index)
+	{
+		std::filesystem::remove(Directory / Segments[Index], Error);
+	}
+}
+
+void GlxFileLogSink::RunWriter()
+{
+	BufferMutex.Lock();
+
+	while (true)
+	{
+		if (!WriteRequested && !StopRequested)
+		{
+			WriterCondition.WaitFor(BufferMutex, Settings.FlushIntervalMilliseconds);
+		}
+
+		BufferType* Batch = FrontBuffer;
+		FrontBuffer = FrontBuffer == &Buffers[0] ? &Buffers[1] : &Buffers[0];
+
+		const GlxUInt64 Target = BufferedBytes;
+		const GlxBool Sync = SyncRequested;
+		const GlxBool Stop = StopRequested;
+		WriteRequested = false;
+		SyncRequested = false;
+
+		// Callers waiting for room can fill the other buffer while this one is written.
+		WrittenCondition.NotifyAll();
+		BufferMutex.Unlock();
+
+		WriteBatch(*Batch, Sync);
+		Batch->clear();
+
+		BufferMutex.Lock();
+		WrittenBytes = Target;
+		WrittenCondition.NotifyAll();
+
+		if (Stop && FrontBuffer->size() == 0)
+		{
+			break;
+		}
+	}
+
+	BufferMutex.Unlock();
+}
+
+void GlxFileLogSink::RunCompressor()
+{
+	CompressMutex.Lock();
+
+	while (true)
+	{
+		if (PendingSegments.IsEmpty())
+		{
+			if (CompressorStopRequested)
+			{
+				break;
+			}
+
+			CompressCondition.Wait(CompressMutex);
+			continue;
+		}
+
+		const GlxPath Segment = PendingSegments[0];
+		PendingSegments.RemoveAt(0);
+		CompressMutex.Unlock();
+
+		if (!Segment.empty() && Settings.CompressRotatedFiles)
+		{
+			GlxPath Compressed = Segment;
+			Compressed += ".gz";
+
+			std::error_code Error;
+
+			if (GlxGzip::CompressFile(Segment, Compressed))
+			{
+				std::filesystem::remove(Segment, Error);
+			}
+			else
+			{
+				std::filesystem::remove(Compressed, Error);
+			}
+		}
+
+		RemoveOldSegments();
+
+		CompressMutex.Lock();
+	}
+
+	CompressMutex.Unlock();
+}
@@ -3,12 +3,16 @@
 #include "GLX/Preprocessor.h"
 #include "GLX/Types/Delegate.h"
 #include "GLX/String/String.h"
-#include "GLX/Containers/List.h"
+#include "GLX/Containers/DynamicArray.h"
 #include "GLX/Threading/Mutex.h"
 #include "GLX/Threading/ScopedLock.h"
+#include "GLX/Threading/Thread.h"
+#include "GLX/Threading/ConditionVariable.h"
+#include "GLX/Threading/Atomic.h"
 
 #include "LogRecord.h"
 #include "LogProperties.h"
+#include "LogQueue.h"
 
 #include "GLX/ThirdParty/fmt/core.h"
 #include "GLX/ThirdParty/fmt/xchar.h"
@@ -17,9 +21,24 @@
 
 using GlxLogCallback = void (*)(const GlxLogRecord&);
 
+// Settings for GlxLog::EnableAsyncMode().
+class GlxLogAsyncSettings
+{
+public:
+	// Number of records the queue holds; rounded up to a power of two.
+	GlxInt64 QueueCapacity = 8192;
+	GlxELogOverflowPolicy OverflowPolicy = GlxELogOverflowPolicy::Block;
+	// How long the flusher sleeps when the queue is empty before it checks again.
+	GlxInt32 FlushIntervalMilliseconds = 50;
+	// Most records the flusher hands to the callbacks before it checks the queue counters again.
+	GlxInt32 MaxBatchSize = 256;
+};
+
 class GLX_API GlxLog
 {
 public:
+	friend class GlxBinaryLog;
+
 	static GLX_CONSTEXPR const GlxChar* LogLevelToCString[6] = {
 		"Debug",
 		"Info",
@@ -74,11 +93,107 @@ public:
 		LogImpl<TLogProperties, TChar, GlxELogLevel::Fatal, TArgs...>(InProperties, InString, Forward<TArgs>(InArgs)...);
 	}
 
+	// False when calls at InLevel in this category are removed by GLX_LOG_MIN_LEVEL or the category's
+	// CompileTimeMinLevel. Fatal calls are always kept, since they end the program whatever the level.
+	template<typename TLogProperties, GlxELogLevel InLevel>
+	static GLX_CONSTEXPR GlxBool IsLevelCompiledIn()
+	{
+		return InLevel == GlxELogLevel::Fatal ||
+			(GlxNsPrivate::GlxLogPropertiesBase::PassesLevel(InLevel, GLX_LOG_MIN_LEVEL) &&
+				GlxNsPrivate::GlxLogPropertiesBase::PassesLevel(InLevel, TLogProperties::CompileTimeMinLevel));
+	}
+
 private:
-	using LogCallbackList = GlxList<GlxLogCallback>;
+	using LogCallbackArray = GlxDynamicArray<GlxLogCallback>;
+
+	// Hazard pointer of one thread: the callback snapshot it is dispatching to, which writers must not free. Slots are
+	// never deleted; a thread that exits hands its slot to the next thread that needs one.
+	class alignas(GlxLogQueue::CacheLineSize) GlxDispatchSlot
+	{
+	public:
+		GlxAtomic<const LogCallbackArray*> Hazard{ nullptr };
+		GlxAtomic<GlxBool> InUse{ true };
+		GlxDispatchSlot* Next = nullptr;
+	};
+
+	class GlxDispatchSlotOwner
+	{
+	public:
+		~GlxDispatchSlotOwner()
+		{
+			if (Slot)
+			{
+				Slot->Hazard.store(nullptr, std::memory_order_release);
+				Slot->InUse.store(false, std::memory_order_release);
+				Slot = nullptr;
+			}
+		}
+
+		GlxDispatchSlot* Slot = nullptr;
+		// Snapshot the thread is dispatching to right now, so a callback that logs does not overwrite the hazard.
+		const LogCallbackArray* Active = nullptr;
+	};
+
+	// The calling thread's format buffer, reused across calls so long messages stop allocating once it has grown. A
+	// callback that logs formats into a buffer of its own, since the record being dispatched still points into this one.
+	template<typename TChar>
+	class GlxScopedFormatBuffer
+	{
+	public:
+		GlxScopedFormatBuffer()
+			: Buffer(InUse ? &LocalBuffer : &ThreadBuffer)
+		{
+			if (Buffer == &ThreadBuffer)
+			{
+				InUse = true;
+				ThreadBuffer.clear();
+			}
+		}
+
+		~GlxScopedFormatBuffer()
+		{
+			if (Buffer == &ThreadBuffer)
+			{
+				InUse = false;
+			}
+		}
+
+		GlxScopedFormatBuffer(const GlxScopedFormatBuffer&) = delete;
+		GlxScopedFormatBuffer& operator=(const GlxScopedFormatBuffer&) = delete;
 
+		GLX_FORCE_INLINE fmt::basic_memory_buffer<TChar>& Get()
+		{
+			return *Buffer;
+		}
+
+	private:
+		static thread_local fmt::basic_memory_buffer<TChar> ThreadBuffer;
+		static thread_local GlxBool InUse;
+
+		fmt::basic_memory_buffer<TChar>* Buffer;
+		fmt::basic_memory_buffer<TChar> LocalBuffer;
+	};
+
+	// Serializes changes to the callback list; dispatch never takes it.
 	static GlxMutex LogMutex;
-	static LogCallbackList LogCallbacks;
+	// Current immutable callback list, or null if there are none. Writers swap in a modified copy and retire the old
+	// one until no hazard pointer refers to it.
+	static GlxAtomic<const LogCallbackArray*> CallbackSnapshot;
+	static GlxDynamicArray<const LogCallbackArray*> RetiredSnapshots;
+	static GlxAtomic<GlxDispatchSlot*> DispatchSlots;
+	static thread_local GlxDispatchSlotOwner ThreadDispatchSlot;
+
+	static GlxAtomic<GlxLogQueue*> AsyncQueue;
+	static GlxLogAsyncSettings AsyncSettings;
+	static GlxThread* FlusherThread;
+	static GlxMutex AsyncMutex;
+	static GlxConditionVariable FlusherCondition;
+	static GlxConditionVariable FlushedCondition;
+	static GlxAtomic<GlxBool> FlusherIdle;
+	static GlxAtomic<GlxBool> StopRequested;
+	static GlxAtomic<GlxUInt64> FlushedCount;
+	static GlxAtomic<GlxUInt64> DroppedCount;
+	static thread_local GlxBool IsFlusherThread;
 
 	template<typename TLogProperties, typename TChar, GlxELogLevel InLevel, typename... TArgs>
 	static void LogImpl(const TLogProperties& InProperties, const TChar* InString, TArgs&&... InArgs)
@@ -89,129 +204,531 @@ private:
 		static_assert(GlxOr<GlxIsSame<TChar, GlxChar>, GlxIsSame<TChar, GlxWChar>>::Value);
 		static_assert(GlxIsBaseOf<GlxNsPrivate::GlxLogPropertiesBase, TLogProperties>::Value);
 
-		if (InProperties.Level == GlxELogLevel::Off)
-		{
-			return;
-		}
-
-		if (InProperties.Level == GlxELogLevel::All || InProperties.Level <= InLevel)
+		if (InProperties.IsLevelEnabled(InLevel))
 		{
-			fmt::basic_memory_buffer<TChar> Buffer = fmt::basic_memory_buffer<TChar>();
+			GlxScopedFormatBuffer<TChar> ScopedBuffer;
+			fmt::basic_memory_buffer<TChar>& Buffer = ScopedBuffer.Get();
 			std::chrono::time_point Now = std::chrono::system_clock::now();
+			const GlxBasicString<TChar>& Prefix = GetPrefixFormat<TLogProperties, TChar, InLevel>();
 
+			// The prefix and the message are formatted separately, so the caller's string never has to be copied into
+			// a combined format string and its argument indices start at 0.
 			if constexpr (GlxIsSame<TChar, GlxChar>::Value)
 			{
-				GlxString FmtString("[{:%Y-%m-%d %H:%M:%S}] [{}] {}: ");
-				FmtString += InString;
-				FmtString += '\n';
-				fmt::detail::vformat_to(
-					Buffer,
-					fmt::string_view{ FmtString.GetData(), static_cast<GlxSizeT>(FmtString.GetElementCount()) },
-					fmt::make_format_args(Now, TLogProperties::Name, LogLevelToCString[static_cast<GlxInt32>(InLevel)], InArgs...));
+				fmt::detail::vformat_to(Buffer, fmt::string_view{ Prefix.GetData(), static_cast<GlxSizeT>(Prefix.GetElementCount()) }, fmt::make_format_args(Now));
+				fmt::detail::vformat_to(Buffer, fmt::string_view{ InString }, fmt::make_format_args(InArgs...));
 			}
 			else if constexpr (GlxIsSame<TChar, GlxWChar>::Value)
 			{
-				GlxWString FmtString(L"[{:%Y-%m-%d %H:%M:%S}] [{}] {}: ");
-				FmtString += InString;
-				FmtString += L'\n';
 				fmt::detail::vformat_to(
-					Buffer,
-					fmt::wstring_view{ FmtString.GetData(), static_cast<GlxSizeT>(FmtString.GetElementCount()) },
-					fmt::make_format_args<fmt::wformat_context>(Now, TLogProperties::NameW, LogLevelToWString[static_cast<GlxInt32>(InLevel)], InArgs...));
+					Buffer, fmt::wstring_view{ Prefix.GetData(), static_cast<GlxSizeT>(Prefix.GetElementCount()) }, fmt::make_format_args<fmt::wformat_context>(Now));
+				fmt::detail::vformat_to(Buffer, fmt::wstring_view{ InString }, fmt::make_format_args<fmt::wformat_context>(InArgs...));
 			}
 
+			Buffer.push_back(static_cast<TChar>('\n'));
 			Buffer.push_back(static_cast<TChar>(0));
 
-			LogMutex.Lock();
-
 			GlxLogRecord CurrentRecord{};
+			CurrentRecord.Data = Buffer.data();
+			CurrentRecord.DataLength = Buffer.size() - 1;
+			CurrentRecord.Level = InLevel;
 
-			for (LogCallbackList::IteratorType Begin = LogCallbacks.begin(), End = LogCallbacks.end(); Begin != End; ++Begin)
+			if constexpr (GlxIsSame<TChar, GlxChar>::Value)
 			{
-				CurrentRecord.Data = Buffer.data();
-				CurrentRecord.DataLength = Buffer.size() - 1;
-				CurrentRecord.Level = InLevel;
-
-				if constexpr (GlxIsSame<TChar, GlxChar>::Value)
-				{
-					CurrentRecord.CharType = GlxECharType::Char;
-				}
-				else if constexpr (GlxIsSame<TChar, GlxWChar>::Value)
-				{
-					CurrentRecord.CharType = GlxECharType::WChar;
-				}
+				CurrentRecord.CharType = GlxECharType::Char;
+			}
+			else if constexpr (GlxIsSame<TChar, GlxWChar>::Value)
+			{
+				CurrentRecord.CharType = GlxECharType::WChar;
+			}
 
-				(*Begin)(CurrentRecord);
+			if (GlxLogQueue* Queue = AsyncQueue.load(std::memory_order_acquire))
+			{
+				EnqueueRecord(*Queue, CurrentRecord);
+			}
+			else
+			{
+				DispatchRecord(CurrentRecord);
 			}
-			LogMutex.Unlock();
 		}
 
 		if constexpr (InLevel == GlxELogLevel::Fatal)
 		{
-			LogCallbacks.Release();
+			Flush();
+			ClearAllLogCallbacks();
 			std::abort();
 		}
 	}
 
-	static GLX_FORCE_INLINE LogCallbackList::IteratorType FindLogCallback(GlxLogCallback InCallback)
+	// "[<time>] [<category>] <level>: " as a format string taking the time, built once per category, level and
+	// character type.
+	template<typename TLogProperties, typename TChar, GlxELogLevel InLevel>
+	static const GlxBasicString<TChar>& GetPrefixFormat()
+	{
+		static const GlxBasicString<TChar> Prefix = []()
+		{
+			GlxBasicString<TChar> Result;
+
+			if constexpr (GlxIsSame<TChar, GlxChar>::Value)
+			{
+				Result += "[{:%Y-%m-%d %H:%M:%S}] [";
+				Result += TLogProperties::Name;
+				Result += "] ";
+				Result += LogLevelToCString[static_cast<GlxInt32>(InLevel)];
+				Result += ": ";
+			}
+			else if constexpr (GlxIsSame<TChar, GlxWChar>::Value)
+			{
+				Result += L"[{:%Y-%m-%d %H:%M:%S}] [";
+				Result += TLogProperties::NameW;
+				Result += L"] ";
+				Result += LogLevelToWString[static_cast<GlxInt32>(InLevel)];
+				Result += L": ";
+			}
+
+			return Result;
+		}();
+
+		return Prefix;
+	}
+
+	// Takes no lock: the thread publishes the snapshot it reads in its hazard slot and checks that it is still current,
+	// after which no writer frees it. Callbacks can therefore run on several threads at once and must be thread-safe.
+	static GLX_FORCE_INLINE void DispatchRecord(const GlxLogRecord& InRecord)
 	{
-		LogCallbackList::IteratorType Begin = LogCallbacks.begin();
-		LogCallbackList::IteratorType End = LogCallbacks.end();
-		for (; Begin != End; ++Begin)
+		GlxDispatchSlotOwner& Owner = ThreadDispatchSlot;
+
+		if (Owner.Active)
 		{
-			if (*Begin == InCallback)
+			InvokeCallbacks(*Owner.Active, InRecord);
+			return;
+		}
+
+		const LogCallbackArray* Snapshot = CallbackSnapshot.load(std::memory_order_acquire);
+
+		if (!Snapshot)
+		{
+			return;
+		}
+
+		GlxDispatchSlot* Slot = Owner.Slot ? Owner.Slot : AcquireDispatchSlot();
+
+		while (true)
+		{
+			Slot->Hazard.store(Snapshot, std::memory_order_seq_cst);
+			const LogCallbackArray* Current = CallbackSnapshot.load(std::memory_order_seq_cst);
+
+			if (Current == Snapshot)
+			{
+				break;
+			}
+
+			if (!Current)
 			{
-				return Begin;
+				Slot->Hazard.store(nullptr, std::memory_order_release);
+				return;
 			}
+
+			Snapshot = Current;
 		}
 
-		return End;
+		Owner.Active = Snapshot;
+		InvokeCallbacks(*Snapshot, InRecord);
+		Owner.Active = nullptr;
+
+		Slot->Hazard.store(nullptr, std::memory_order_release);
 	}
 
+	static GLX_FORCE_INLINE void InvokeCallbacks(const LogCallbackArray& InCallbacks, const GlxLogRecord& InRecord)
+	{
+		for (GlxLogCallback Callback : InCallbacks)
+		{
+			Callback(InRecord);
+		}
+	}
+
+	static GlxDispatchSlot* AcquireDispatchSlot();
+	// Must be called with LogMutex held.
+	static void PublishCallbacks(const LogCallbackArray* InCallbacks);
+	// Waits until no other thread is dispatching to InSnapshot. Must be called without LogMutex, since the callbacks
+	// being waited for may add or remove callbacks themselves.
+	static void WaitForDispatchers(const LogCallbackArray* InSnapshot);
+
+	static void EnqueueRecord(GlxLogQueue& InQueue, const GlxLogRecord& InRecord);
+	static GlxBool DispatchBatch(GlxLogQueue& InQueue);
+	static void WakeFlusher();
+	static void RunFlusher(GlxLogQueue* InQueue);
+
 public:
 	static GlxBool AddLogCallback(GlxLogCallback InCallback);
+
+	// Once these return, no other thread is still running a removed callback, so whatever it uses can be freed. A
+	// callback that removes callbacks (itself included) only waits for the other threads; its own call runs to the end.
+	// Do not call them while holding a lock that a callback may take.
 	static GlxBool RemoveLogCallback(GlxLogCallback InCallback);
 	static void ClearAllLogCallbacks();
+
+	// Switches to asynchronous logging: callers only format the message and copy it into a bounded queue, and a
+	// background thread hands the queued records to the callbacks in batches. Returns false if async mode is already on.
+	static GlxBool EnableAsyncMode(const GlxLogAsyncSettings& InSettings = GlxLogAsyncSettings());
+
+	// Delivers everything still queued, stops the flusher thread and goes back to synchronous logging. No other thread
+	// may be logging while this runs. Call it before exit, or records still in the queue are lost.
+	static void DisableAsyncMode();
+
+	// Blocks until every record logged before the call has been handed to the callbacks (or dropped by the overflow
+	// policy). Does nothing in synchronous mode.
+	static void Flush();
+
+	static GlxBool IsAsyncModeEnabled();
+
+	// Records discarded because the queue was full, over the life of the program.
+	static GlxUInt64 GetDroppedRecordCount();
 };
 
 void DefaultConsoleLogCallback(const GlxLogRecord& InRecord);
 
 
+template<typename TChar>
+thread_local fmt::basic_memory_buffer<TChar> GlxLog::GlxScopedFormatBuffer<TChar>::ThreadBuffer;
+template<typename TChar>
+thread_local GlxBool GlxLog::GlxScopedFormatBuffer<TChar>::InUse = false;
+
 GlxMutex GlxLog::LogMutex;
-GlxLog::LogCallbackList GlxLog::LogCallbacks;
+GlxAtomic<const GlxLog::LogCallbackArray*> GlxLog::CallbackSnapshot{ nullptr };
+GlxDynamicArray<const GlxLog::LogCallbackArray*> GlxLog::RetiredSnapshots;
+GlxAtomic<GlxLog::GlxDispatchSlot*> GlxLog::DispatchSlots{ nullptr };
+thread_local GlxLog::GlxDispatchSlotOwner GlxLog::ThreadDispatchSlot;
+
+GlxAtomic<GlxLogQueue*> GlxLog::AsyncQueue{ nullptr };
+GlxLogAsyncSettings GlxLog::AsyncSettings;
+GlxThread* GlxLog::FlusherThread = nullptr;
+GlxMutex GlxLog::AsyncMutex;
+GlxConditionVariable GlxLog::FlusherCondition;
+GlxConditionVariable GlxLog::FlushedCondition;
+GlxAtomic<GlxBool> GlxLog::FlusherIdle{ false };
+GlxAtomic<GlxBool> GlxLog::StopRequested{ false };
+GlxAtomic<GlxUInt64> GlxLog::FlushedCount{ 0 };
+GlxAtomic<GlxUInt64> GlxLog::DroppedCount{ 0 };
+thread_local GlxBool GlxLog::IsFlusherThread = false;
 
 GlxBool GlxLog::AddLogCallback(GlxLogCallback InCallback)
 {
 	GlxScopedLock<GlxMutex> Lock{ LogMutex };
 
-	if (FindLogCallback(InCallback) != LogCallbacks.end())
+	const LogCallbackArray* Callbacks = CallbackSnapshot.load(std::memory_order_relaxed);
+
+	if (Callbacks && Callbacks->Contains(InCallback))
 	{
 		return false;
 	}
 
-	LogCallbacks.EmplaceBack(InCallback);
+	LogCallbackArray* NewCallbacks = Callbacks ? new LogCallbackArray(*Callbacks) : new LogCallbackArray();
+	NewCallbacks->EmplaceBack(InCallback);
+	PublishCallbacks(NewCallbacks);
 	return true;
 }
 
 GlxBool GlxLog::RemoveLogCallback(GlxLogCallback InCallback)
 {
-	GlxScopedLock<GlxMutex> Lock{ LogMutex };
+	const LogCallbackArray* Callbacks;
 
-	LogCallbackList::IteratorType It = FindLogCallback(InCallback);
-	if (It == LogCallbacks.end())
 	{
-		return false;
+		GlxScopedLock<GlxMutex> Lock{ LogMutex };
+
+		Callbacks = CallbackSnapshot.load(std::memory_order_relaxed);
+
+		if (!Callbacks || !Callbacks->Contains(InCallback))
+		{
+			return false;
+		}
+
+		LogCallbackArray* NewCallbacks = nullptr;
+
+		if (Callbacks->GetElementCount() > 1)
+		{
+			NewCallbacks = new LogCallbackArray(*Callbacks);
+			NewCallbacks->Remove(InCallback);
+		}
+
+		PublishCallbacks(NewCallbacks);
 	}
 
-	LogCallbacks.RemoveAt(It.GetNode());
+	WaitForDispatchers(Callbacks);
 	return true;
 }
 
 void GlxLog::ClearAllLogCallbacks()
 {
-	LogMutex.Lock();
-	LogCallbacks.Clear();
-	LogMutex.Unlock();
+	const LogCallbackArray* Callbacks;
+
+	{
+		GlxScopedLock<GlxMutex> Lock{ LogMutex };
+
+		Callbacks = CallbackSnapshot.load(std::memory_order_relaxed);
+		PublishCallbacks(nullptr);
+	}
+
+	if (Callbacks)
+	{
+		WaitForDispatchers(Callbacks);
+	}
+}
+
+GlxLog::GlxDispatchSlot* GlxLog::AcquireDispatchSlot()
+{
+	GlxDispatchSlot* Slot = DispatchSlots.load(std::memory_order_acquire);
+
+	for (; Slot; Slot = Slot->Next)
+	{
+		GlxBool Expected = false;
+
+		if (!Slot->InUse.load(std::memory_order_relaxed) && Slot->InUse.compare_exchange_strong(Expected, true, std::memory_order_acquire))
+		{
+			break;
+		}
+	}
+
+	if (!Slot)
+	{
+		Slot = new GlxDispatchSlot();
+		Slot->Next = DispatchSlots.load(std::memory_order_relaxed);
+
+		while (!DispatchSlots.compare_exchange_weak(Slot->Next, Slot, std::memory_order_release, std::memory_order_relaxed))
+		{}
+	}
+
+	ThreadDispatchSlot.Slot = Slot;
+	return Slot;
+}
+
+void GlxLog::PublishCallbacks(const LogCallbackArray* InCallbacks)
+{
+	if (const LogCallbackArray* Old = CallbackSnapshot.exchange(InCallbacks, std::memory_order_seq_cst))
+	{
+		RetiredSnapshots.EmplaceBack(Old);
+	}
+
+	// Any thread that still holds a retired snapshot published its hazard before the exchange above, so the scan
+	// below sees it; threads that start dispatching later only find the new snapshot.
+	RetiredSnapshots.RemoveAllSwapIf([](const LogCallbackArray* InRetired)
+	{
+		for (const GlxDispatchSlot* Slot = DispatchSlots.load(std::memory_order_acquire); Slot; Slot = Slot->Next)
+		{
+			if (Slot->Hazard.load(std::memory_order_seq_cst) == InRetired)
+			{
+				return false;
+			}
+		}
+
+		delete InRetired;
+		return true;
+	});
+}
+
+void GlxLog::WaitForDispatchers(const LogCallbackArray* InSnapshot)
+{
+	// The snapshot may already have been freed by a later publish; it is only compared, never read. A thread that
+	// stored it as its hazard but finds it is no longer current backs off without calling anything, so the wait is
+	// short for those.
+	const GlxDispatchSlot* OwnSlot = ThreadDispatchSlot.Slot;
+
+	for (const GlxDispatchSlot* Slot = DispatchSlots.load(std::memory_order_acquire); Slot; Slot = Slot->Next)
+	{
+		if (Slot == OwnSlot)
+		{
+			continue;
+		}
+
+		while (Slot->Hazard.load(std::memory_order_seq_cst) == InSnapshot)
+		{
+			GlxThreadUtils::YieldThisThread();
+		}
+	}
+}
+
+GlxBool GlxLog::EnableAsyncMode(const GlxLogAsyncSettings& InSettings)
+{
+	// Held until the queue is published, so two callers cannot both see it missing and each start a flusher.
+	GlxScopedLock<GlxMutex> Lock{ AsyncMutex };
+
+	if (AsyncQueue.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	AsyncSettings = InSettings;
+	StopRequested.store(false, std::memory_order_relaxed);
+	FlushedCount.store(0, std::memory_order_relaxed);
+
+	GlxLogQueue* Queue = new GlxLogQueue(InSettings.QueueCapacity);
+	FlusherThread = new GlxThread(&GlxLog::RunFlusher, Queue);
+	AsyncQueue.store(Queue, std::memory_order_release);
+	return true;
+}
+
+void GlxLog::DisableAsyncMode()
+{
+	GlxLogQueue* Queue = AsyncQueue.exchange(nullptr, std::memory_order_acq_rel);
+
+	if (!Queue)
+	{
+		return;
+	}
+
+	// The flusher drains the queue before it exits.
+	StopRequested.store(true, std::memory_order_release);
+	WakeFlusher();
+
+	FlusherThread->Join();
+	delete FlusherThread;
+	FlusherThread = nullptr;
+
+	delete Queue;
+}
+
+void GlxLog::Flush()
+{
+	GlxLogQueue* Queue = AsyncQueue.load(std::memory_order_acquire);
+
+	// A callback running on the flusher cannot wait for the flusher.
+	if (!Queue || IsFlusherThread)
+	{
+		return;
+	}
+
+	const GlxUInt64 Target = Queue->GetPushCount();
+
+	GlxScopedLock<GlxMutex> Lock{ AsyncMutex };
+
+	while (FlushedCount.load(std::memory_order_acquire) < Target)
+	{
+		FlusherCondition.NotifyOne();
+		FlushedCondition.WaitFor(AsyncMutex, AsyncSettings.FlushIntervalMilliseconds);
+	}
+}
+
+GlxBool GlxLog::IsAsyncModeEnabled()
+{
+	return AsyncQueue.load(std::memory_order_acquire) != nullptr;
+}
+
+GlxUInt64 GlxLog::GetDroppedRecordCount()
+{
+	return DroppedCount.load(std::memory_order_relaxed);
+}
+
+void GlxLog::EnqueueRecord(GlxLogQueue& InQueue, const GlxLogRecord& InRecord)
+{
+	while (!InQueue.TryPush(InRecord))
+	{
+		switch (AsyncSettings.OverflowPolicy)
+		{
+			case GlxELogOverflowPolicy::Block:
+				// The flusher would be waiting for itself.
+				if (IsFlusherThread)
+				{
+					DroppedCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				WakeFlusher();
+				GlxThreadUtils::YieldThisThread();
+				break;
+			case GlxELogOverflowPolicy::DropNewest:
+				DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			case GlxELogOverflowPolicy::DropOldest:
+				if (InQueue.TryPop([](const GlxLogRecord&) {}))
+				{
+					DroppedCount.fetch_add(1, std::memory_order_relaxed);
+				}
+				break;
+		}
+	}
+
+	// Pairs with the fence in RunFlusher: either the flusher sees this record before it goes to sleep, or this thread
+	// sees that it is idle and wakes it up.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	if (FlusherIdle.load(std::memory_order_relaxed))
+	{
+		WakeFlusher();
+	}
+}
+
+GlxBool GlxLog::DispatchBatch(GlxLogQueue& InQueue)
+{
+	if (InQueue.GetPushCount() == InQueue.GetPopCount())
+	{
+		return false;
+	}
+
+	GlxInt32 Count = 0;
+
+	while (Count < AsyncSettings.MaxBatchSize && InQueue.TryPop([](const GlxLogRecord& InRecord) { DispatchRecord(InRecord); }))
+	{
+		++Count;
+	}
+
+	return Count > 0;
+}
+
+void GlxLog::WakeFlusher()
+{
+	AsyncMutex.Lock();
+	FlusherCondition.NotifyOne();
+	AsyncMutex.Unlock();
+}
+
+void GlxLog::RunFlusher(GlxLogQueue* InQueue)
+{
+	IsFlusherThread = true;
+
+	while (true)
+	{
+		if (DispatchBatch(*InQueue))
+		{
+			// Published after every batch, not only when the queue runs dry, so Flush() returns while other threads
+			// keep logging.
+			AsyncMutex.Lock();
+			FlushedCount.store(InQueue->GetPopCount(), std::memory_order_release);
+			FlushedCondition.NotifyAll();
+			AsyncMutex.Unlock();
+			continue;
+		}
+
+		AsyncMutex.Lock();
+
+		// Everything below the pop count has now been delivered or dropped.
+		FlushedCount.store(InQueue->GetPopCount(), std::memory_order_release);
+		FlushedCondition.NotifyAll();
+
+		FlusherIdle.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+
+		const GlxBool Empty = InQueue->GetPushCount() == InQueue->GetPopCount();
+
+		if (Empty && StopRequested.load(std::memory_order_acquire))
+		{
+			FlusherIdle.store(false, std::memory_order_relaxed);
+			AsyncMutex.Unlock();
+			break;
+		}
+
+		if (Empty)
+		{
+			FlusherCondition.WaitFor(AsyncMutex, AsyncSettings.FlushIntervalMilliseconds);
+		}
+
+		FlusherIdle.store(false, std::memory_order_relaxed);
+		AsyncMutex.Unlock();
+
+		// A producer has claimed a slot but not finished writing it.
+		if (!Empty)
+		{
+			GlxThreadUtils::YieldThisThread();
+		}
+	}
 }
 
 void DefaultConsoleLogCallback(const GlxLogRecord& InRecord)
@@ -232,34 +749,78 @@ void DefaultConsoleLogCallback(const GlxLogRecord& InRecord)
 			break;
 	}
 
+	// The text is already formatted; passing it as a format string would misread any '%' in the message.
 	switch (InRecord.CharType)
 	{
 		case GlxECharType::Char:
-			fprintf(OutputType, static_cast<const GlxChar*>(InRecord.Data));
+			std::fwrite(InRecord.Data, sizeof(GlxChar), InRecord.DataLength, OutputType);
 			break;
 		case GlxECharType::WChar:
-			fwprintf(OutputType, static_cast<const GlxWChar*>(InRecord.Data));
+			std::fputws(static_cast<const GlxWChar*>(InRecord.Data), OutputType);
 	}
 }
 
+// Calls removed by GlxLog::IsLevelCompiledIn() are not compiled at all, and calls disabled by the category's runtime
+// level skip evaluating their arguments.
+#if !defined(GLX_LOG_IF_LEVEL_ENABLED)
+	#define GLX_LOG_IF_LEVEL_ENABLED(InProperties, InLevel)                                                   \
+		if constexpr (GlxLog::IsLevelCompiledIn<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties), InLevel>()) \
+			if (GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties).IsLevelEnabled(InLevel)) GLX_UNLIKELY
+#endif
+
 #if !defined(GLX_LOG_DEBUG)
-	#define GLX_LOG_DEBUG(InProperties, ...) GlxLog::Debug<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__)
+	#define GLX_LOG_DEBUG(InProperties, ...)                                                                                                     \
+		do                                                                                                                                       \
+		{                                                                                                                                        \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Debug)                                                                          \
+			{                                                                                                                                    \
+				GlxLog::Debug<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__); \
+			}                                                                                                                                    \
+		} while (false)
 #endif
 
 #if !defined(GLX_LOG_INFO)
-	#define GLX_LOG_INFO(InProperties, ...) GlxLog::Info<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__)
+	#define GLX_LOG_INFO(InProperties, ...)                                                                                                     \
+		do                                                                                                                                      \
+		{                                                                                                                                       \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Info)                                                                          \
+			{                                                                                                                                   \
+				GlxLog::Info<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__); \
+			}                                                                                                                                   \
+		} while (false)
 #endif
 
 #if !defined(GLX_LOG_SUCCESS)
-	#define GLX_LOG_SUCCESS(InProperties, ...) GlxLog::Success<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__)
+	#define GLX_LOG_SUCCESS(InProperties, ...)                                                                                                     \
+		do                                                                                                                                         \
+		{                                                                                                                                          \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Success)                                                                          \
+			{                                                                                                                                      \
+				GlxLog::Success<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__); \
+			}                                                                                                                                      \
+		} while (false)
 #endif
 
 #if !defined(GLX_LOG_WARNING)
-	#define GLX_LOG_WARNING(InProperties, ...) GlxLog::Warning<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__)
+	#define GLX_LOG_WARNING(InProperties, ...)                                                                                                     \
+		do                                                                                                                                         \
+		{                                                                                                                                          \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Warning)                                                                          \
+			{                                                                                                                                      \
+				GlxLog::Warning<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__); \
+			}                                                                                                                                      \
+		} while (false)
 #endif
 
 #if !defined(GLX_LOG_ERROR)
-	#define GLX_LOG_ERROR(InProperties, ...) GlxLog::Error<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__)
+	#define GLX_LOG_ERROR(InProperties, ...)                                                                                                     \
+		do                                                                                                                                       \
+		{                                                                                                                                        \
+			GLX_LOG_IF_LEVEL_ENABLED(InProperties, GlxELogLevel::Error)                                                                          \
+			{                                                                                                                                    \
+				GlxLog::Error<GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InProperties)>(GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InProperties), __VA_ARGS__); \
+			}                                                                                                                                    \
+		} while (false)
 #endif
 
 #if !defined(GLX_LOG_FATAL)
@@ -7,13 +7,22 @@
 
 class GlxLog;
 
+// Log calls below this level are removed at compile time in every category, arguments included. Takes the same values
+// as a runtime level: All keeps everything, Off keeps only Fatal calls.
+#if !defined(GLX_LOG_MIN_LEVEL)
+	#define GLX_LOG_MIN_LEVEL GlxELogLevel::All
+#endif
+
 namespace GlxNsPrivate
 {
 	class GlxLogPropertiesBase
 	{
 	public:
+		// Per-category counterpart of GLX_LOG_MIN_LEVEL; see GLX_DEFINE_LOG_PROPERTIES_WITH_MIN_LEVEL.
+		static GLX_CONSTEXPR GlxELogLevel CompileTimeMinLevel = GlxELogLevel::All;
+
 		GLX_FORCE_INLINE GlxLogPropertiesBase(GlxELogLevel InLevel)
-			: Level(InLevel)
+			: Level(InLevel), EnabledLevels(MakeEnabledLevels(InLevel))
 		{}
 
 		GlxLogPropertiesBase() = default;
@@ -23,6 +32,12 @@ namespace GlxNsPrivate
 		GlxLogPropertiesBase& operator=(GlxLogPropertiesBase&&) noexcept = default;
 		~GlxLogPropertiesBase() = default;
 
+		// Whether a call at InLevel gets past the threshold InMinLevel.
+		static GLX_CONSTEXPR GlxBool PassesLevel(GlxELogLevel InLevel, GlxELogLevel InMinLevel)
+		{
+			return InMinLevel == GlxELogLevel::All || (InMinLevel != GlxELogLevel::Off && InMinLevel <= InLevel);
+		}
+
 		GLX_FORCE_INLINE GlxELogLevel GetLogLevel() const
 		{
 			return Level;
@@ -31,9 +46,33 @@ namespace GlxNsPrivate
 		GLX_FORCE_INLINE void SetLogLevel(GlxELogLevel InLevel)
 		{
 			Level = InLevel;
+			EnabledLevels = MakeEnabledLevels(InLevel);
+		}
+
+		// A single bit test, so call sites can check it before evaluating any arguments.
+		GLX_FORCE_INLINE GlxBool IsLevelEnabled(GlxELogLevel InLevel) const
+		{
+			return (EnabledLevels >> static_cast<GlxUInt32>(InLevel)) & 1u;
 		}
 
-		GlxELogLevel Level;
+	private:
+		static GLX_CONSTEXPR GlxUInt8 MakeEnabledLevels(GlxELogLevel InMinLevel)
+		{
+			GlxUInt8 Mask = 0;
+
+			for (GlxInt32 Index = static_cast<GlxInt32>(GlxELogLevel::Debug); Index <= static_cast<GlxInt32>(GlxELogLevel::Fatal); ++Index)
+			{
+				if (PassesLevel(static_cast<GlxELogLevel>(Index), InMinLevel))
+				{
+					Mask |= static_cast<GlxUInt8>(1u << Index);
+				}
+			}
+
+			return Mask;
+		}
+
+		GlxELogLevel Level = GlxELogLevel::All;
+		GlxUInt8 EnabledLevels = MakeEnabledLevels(GlxELogLevel::All);
 	};
 }
 
@@ -46,19 +85,25 @@ namespace GlxNsPrivate
 	#define GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InName) LP##InName
 #endif
 
-#if !defined(GLX_DEFINE_LOG_PROPERTIES)
-	#define GLX_DEFINE_LOG_PROPERTIES(InName, InLevel)                                                  \
+// Like GLX_DEFINE_LOG_PROPERTIES, but calls in this category below InMinLevel are removed at compile time.
+#if !defined(GLX_DEFINE_LOG_PROPERTIES_WITH_MIN_LEVEL)
+	#define GLX_DEFINE_LOG_PROPERTIES_WITH_MIN_LEVEL(InName, InLevel, InMinLevel)                       \
 		class GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InName) : public GlxNsPrivate::GlxLogPropertiesBase    \
 		{                                                                                               \
 		public:                                                                                         \
 			static GLX_CONSTEXPR const GlxChar* Name = GLX_STRINGIFY(InName);                           \
 			static GLX_CONSTEXPR const GlxWChar* NameW = GLX_STRINGIFY_W(InName);                       \
+			static GLX_CONSTEXPR GlxELogLevel CompileTimeMinLevel = InMinLevel;                         \
 			GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InName)() : GlxNsPrivate::GlxLogPropertiesBase(InLevel)  \
 			{}                                                                                          \
 		};                                                                                              \
 		static GLX_MAKE_LOG_PROPERTIES_CLASS_NAME(InName) GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InName) {}
 #endif
 
+#if !defined(GLX_DEFINE_LOG_PROPERTIES)
+	#define GLX_DEFINE_LOG_PROPERTIES(InName, InLevel) GLX_DEFINE_LOG_PROPERTIES_WITH_MIN_LEVEL(InName, InLevel, GlxELogLevel::All)
+#endif
+
 #if !defined(GLX_GET_LOG_LEVEL)
 	#define GLX_GET_LOG_LEVEL(InName) GLX_MAKE_LOG_PROPERTIES_OBJECT_NAME(InName).GetLogLevel();
 #endif
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Preprocessor.h"
+#include "GLX/Types/DataTypes.h"
+#include "GLX/Memory/MemoryUtils.h"
+#include "GLX/Utils/BitUtils.h"
+#include "GLX/Utils/NonCopyable.h"
+#include "GLX/Threading/Atomic.h"
+
+#include "LogRecord.h"
+
+#include <new>
+
+// What a producer does when the async log queue is full.
+enum class GlxELogOverflowPolicy : GlxInt8
+{
+	Block,      // Wait for the flusher to free a slot.
+	DropNewest, // Discard the record being logged.
+	DropOldest, // Discard the oldest queued record to make room.
+};
+
+// Bounded ring of log records (Vyukov's array queue). Every slot carries a sequence number telling whether it is ready
+// to be written or read, so producers and the consumer only contend on two counters and never take a lock. Any thread
+// may pop, which is what lets a producer evict the oldest record under GlxELogOverflowPolicy::DropOldest. Text that
+// fits in a slot is stored inline; longer records get their own heap block.
+class GlxLogQueue : public GlxNonCopyable
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GLX_CONSTEXPR GlxSizeT SlotSize = 256;
+	static GLX_CONSTEXPR GlxSizeT CacheLineSize = 64;
+
+	explicit GlxLogQueue(SizeType InCapacity)
+		: Capacity(static_cast<SizeType>(GlxBitUtils::RoundUpToPowerOfTwo(static_cast<GlxUInt64>(InCapacity > 2 ? InCapacity : 2)))),
+		  Mask(static_cast<GlxUInt64>(Capacity - 1))
+	{
+		Slots = static_cast<GlxSlot*>(GLX_MALLOC(Capacity * sizeof(GlxSlot)));
+
+		for (SizeType Index = 0; Index < Capacity; ++Index)
+		{
+			new (&Slots[Index].Sequence) GlxAtomic<GlxUInt64>(static_cast<GlxUInt64>(Index));
+		}
+	}
+
+	~GlxLogQueue()
+	{
+		while (TryPop([](const GlxLogRecord&) {}))
+		{}
+
+		GLX_FREE(Slots);
+	}
+
+	GLX_FORCE_INLINE SizeType GetCapacity() const
+	{
+		return Capacity;
+	}
+
+	// Number of records ever claimed by producers / removed by consumers. Everything below GetPopCount() has been
+	// delivered or dropped.
+	GLX_FORCE_INLINE GlxUInt64 GetPushCount() const
+	{
+		return PushPos.load(std::memory_order_acquire);
+	}
+
+	GLX_FORCE_INLINE GlxUInt64 GetPopCount() const
+	{
+		return PopPos.load(std::memory_order_acquire);
+	}
+
+	// Copies the record's text (DataLength characters plus the terminator). Returns false if the queue is full.
+	GlxBool TryPush(const GlxLogRecord& InRecord)
+	{
+		GlxUInt64 Pos = PushPos.load(std::memory_order_relaxed);
+		GlxSlot* Slot;
+
+		while (true)
+		{
+			Slot = &Slots[Pos & Mask];
+			const GlxInt64 Diff = static_cast<GlxInt64>(Slot->Sequence.load(std::memory_order_acquire) - Pos);
+
+			if (Diff == 0)
+			{
+				if (PushPos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = PushPos.load(std::memory_order_relaxed);
+			}
+		}
+
+		const GlxSizeT CharSize = InRecord.CharType == GlxECharType::Char ? sizeof(GlxChar) : sizeof(GlxWChar);
+		const GlxSizeT ByteCount = (InRecord.DataLength + 1) * CharSize;
+
+		Slot->HeapData = ByteCount > sizeof(Slot->InlineData) ? GLX_MALLOC(ByteCount) : nullptr;
+		GLX_MEMCPY(Slot->HeapData ? Slot->HeapData : Slot->InlineData, InRecord.Data, ByteCount);
+		Slot->DataLength = InRecord.DataLength;
+		Slot->Level = InRecord.Level;
+		Slot->CharType = InRecord.CharType;
+
+		Slot->Sequence.store(Pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Calls InFunc(const GlxLogRecord&) with the oldest record, then frees its slot. Returns false if no record is ready.
+	template<typename TFunc>
+	GlxBool TryPop(TFunc&& InFunc)
+	{
+		GlxUInt64 Pos = PopPos.load(std::memory_order_relaxed);
+		GlxSlot* Slot;
+
+		while (true)
+		{
+			Slot = &Slots[Pos & Mask];
+			const GlxInt64 Diff = static_cast<GlxInt64>(Slot->Sequence.load(std::memory_order_acquire) - (Pos + 1));
+
+			if (Diff == 0)
+			{
+				if (PopPos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Pos = PopPos.load(std::memory_order_relaxed);
+			}
+		}
+
+		GlxLogRecord Record;
+		Record.Data = Slot->HeapData ? Slot->HeapData : Slot->InlineData;
+		Record.DataLength = Slot->DataLength;
+		Record.Level = Slot->Level;
+		Record.CharType = Slot->CharType;
+
+		InFunc(static_cast<const GlxLogRecord&>(Record));
+
+		if (Slot->HeapData)
+		{
+			GLX_FREE(Slot->HeapData);
+		}
+
+		Slot->Sequence.store(Pos + Mask + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	class GlxSlot
+	{
+	public:
+		GlxAtomic<GlxUInt64> Sequence;
+		void* HeapData;
+		GlxSizeT DataLength;
+		GlxELogLevel Level;
+		GlxECharType CharType;
+		alignas(sizeof(GlxWChar)) GlxUInt8 InlineData[SlotSize - sizeof(GlxAtomic<GlxUInt64>) - sizeof(void*) - sizeof(GlxSizeT) - 8];
+	};
+
+	static_assert(sizeof(GlxSlot) == SlotSize, "The size of a log queue slot must be equal to SlotSize.");
+
+	GlxSlot* Slots;
+	const SizeType Capacity;
+	const GlxUInt64 Mask;
+
+	alignas(CacheLineSize) GlxAtomic<GlxUInt64> PushPos{ 0 };
+	alignas(CacheLineSize) GlxAtomic<GlxUInt64> PopPos{ 0 };
+};
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "GLX/Assert.h"
+
+#include "Arena.h"
+#include "MemoryUtils.h"
+
+#include <cstddef>
+
+// Allocator policies used by the containers. An allocator is a small value type:
+//   void* Allocate(GlxSizeT InSize);
+//   void Free(void* InPtr);
+//   void* Reallocate(void* InPtr, GlxSizeT InOldSize, GlxSizeT InNewSize);  -> keeps the first min(Old, New) bytes
+//   GlxBool CanTransferAllocation(const void* InPtr) const;  -> may a block be handed over to another allocator copy on move?
+//   static GLX_CONSTEXPR GlxSizeT InlineBytes;                -> size of the storage a container may use before allocating
+// Copying an allocator copies its configuration, never its storage.
+
+class GlxHeapAllocator
+{
+public:
+	static GLX_CONSTEXPR GlxSizeT InlineBytes = 0;
+
+	GLX_FORCE_INLINE void* Allocate(GlxSizeT InSize)
+	{
+		return GLX_MALLOC(InSize);
+	}
+
+	GLX_FORCE_INLINE void Free(void* InPtr)
+	{
+		GLX_FREE(InPtr);
+	}
+
+	// realloc may extend the block in place (and glibc moves large mmap'ed blocks with mremap), skipping the copy.
+	GLX_FORCE_INLINE void* Reallocate(void* InPtr, GlxSizeT, GlxSizeT InNewSize)
+	{
+		return GLX_REALLOC(InPtr, InNewSize);
+	}
+
+	GLX_FORCE_INLINE GlxBool CanTransferAllocation(const void*) const
+	{
+		return true;
+	}
+};
+
+template<GlxSizeT InAlignment = 64>
+class GlxAlignedAllocator
+{
+public:
+	static GLX_CONSTEXPR GlxSizeT Alignment = InAlignment;
+	static GLX_CONSTEXPR GlxSizeT InlineBytes = 0;
+
+	static_assert(InAlignment >= sizeof(void*) && (InAlignment & (InAlignment - 1)) == 0, "Alignment must be a power of two and at least pointer-sized");
+
+	void* Allocate(GlxSizeT InSize)
+	{
+		// The block returned by GLX_MALLOC is stored just before the aligned pointer.
+		void* RawPtr = GLX_MALLOC(InSize + Alignment - 1 + sizeof(void*));
+
+		if (!RawPtr)
+		{
+			return nullptr;
+		}
+
+		const GlxSizeT Address = (reinterpret_cast<GlxSizeT>(RawPtr) + sizeof(void*) + Alignment - 1) & ~(Alignment - 1);
+		void** AlignedPtr = reinterpret_cast<void**>(Address);
+		AlignedPtr[-1] = RawPtr;
+		return AlignedPtr;
+	}
+
+	void Free(void* InPtr)
+	{
+		if (InPtr)
+		{
+			GLX_FREE(static_cast<void**>(InPtr)[-1]);
+		}
+	}
+
+	// realloc does not preserve the alignment offset, so the block is always copied.
+	void* Reallocate(void* InPtr, GlxSizeT InOldSize, GlxSizeT InNewSize)
+	{
+		void* NewPtr = Allocate(InNewSize);
+
+		if (InPtr)
+		{
+			GLX_MEMCPY(NewPtr, InPtr, InOldSize < InNewSize ? InOldSize : InNewSize);
+			Free(InPtr);
+		}
+
+		return NewPtr;
+	}
+
+	GLX_FORCE_INLINE GlxBool CanTransferAllocation(const void*) const
+	{
+		return true;
+	}
+};
+
+class GlxArenaAllocator
+{
+public:
+	static GLX_CONSTEXPR GlxSizeT InlineBytes = 0;
+
+	GlxArenaAllocator()
+		: Arena(nullptr)
+	{}
+
+	explicit GlxArenaAllocator(GlxArena& InArena)
+		: Arena(&InArena)
+	{}
+
+	GLX_FORCE_INLINE void* Allocate(GlxSizeT InSize)
+	{
+		GLX_ASSERT(Arena && "GlxArenaAllocator has no arena");
+		return Arena->Allocate(InSize);
+	}
+
+	// Memory is reclaimed by GlxArena::Reset/Release.
+	GLX_FORCE_INLINE void Free(void*)
+	{}
+
+	GLX_FORCE_INLINE void* Reallocate(void* InPtr, GlxSizeT InOldSize, GlxSizeT InNewSize)
+	{
+		GLX_ASSERT(Arena && "GlxArenaAllocator has no arena");
+		return Arena->Reallocate(InPtr, InOldSize, InNewSize);
+	}
+
+	GLX_FORCE_INLINE GlxBool CanTransferAllocation(const void*) const
+	{
+		return true;
+	}
+
+	GLX_FORCE_INLINE GlxArena* GetArena() const
+	{
+		return Arena;
+	}
+
+private:
+	GlxArena* Arena;
+};
+
+// Serves the first block that fits from an inline buffer and falls back to TFallbackAllocator for anything else.
+template<GlxSizeT InInlineBytes, GlxSizeT InAlignment = alignof(std::max_align_t), typename TFallbackAllocator = GlxHeapAllocator>
+class GlxInlineAllocator
+{
+public:
+	using FallbackAllocatorType = TFallbackAllocator;
+
+	static GLX_CONSTEXPR GlxSizeT InlineBytes = InInlineBytes;
+	static GLX_CONSTEXPR GlxSizeT Alignment = InAlignment;
+
+	GlxInlineAllocator()
+		: IsInlineInUse(false), Fallback()
+	{}
+
+	explicit GlxInlineAllocator(const FallbackAllocatorType& InFallback)
+		: IsInlineInUse(false), Fallback(InFallback)
+	{}
+
+	GlxInlineAllocator(const GlxInlineAllocator& InOther)
+		: IsInlineInUse(false), Fallback(InOther.Fallback)
+	{}
+
+	GlxInlineAllocator& operator=(const GlxInlineAllocator& InOther)
+	{
+		Fallback = InOther.Fallback;
+		return *this;
+	}
+
+	void* Allocate(GlxSizeT InSize)
+	{
+		if (!IsInlineInUse && InSize <= InlineBytes)
+		{
+			IsInlineInUse = true;
+			return Buffer;
+		}
+
+		return Fallback.Allocate(InSize);
+	}
+
+	void Free(void* InPtr)
+	{
+		if (InPtr == Buffer)
+		{
+			IsInlineInUse = false;
+		}
+		else
+		{
+			Fallback.Free(InPtr);
+		}
+	}
+
+	void* Reallocate(void* InPtr, GlxSizeT InOldSize, GlxSizeT InNewSize)
+	{
+		if (InPtr == Buffer)
+		{
+			if (InNewSize <= InlineBytes)
+			{
+				return Buffer;
+			}
+
+			void* NewPtr = Fallback.Allocate(InNewSize);
+			GLX_MEMCPY(NewPtr, Buffer, InOldSize);
+			IsInlineInUse = false;
+			return NewPtr;
+		}
+
+		if (!IsInlineInUse && InNewSize <= InlineBytes)
+		{
+			IsInlineInUse = true;
+
+			if (InPtr)
+			{
+				GLX_MEMCPY(Buffer, InPtr, InOldSize < InNewSize ? InOldSize : InNewSize);
+				Fallback.Free(InPtr);
+			}
+
+			return Buffer;
+		}
+
+		return Fallback.Reallocate(InPtr, InOldSize, InNewSize);
+	}
+
+	GLX_FORCE_INLINE GlxBool CanTransferAllocation(const void* InPtr) const
+	{
+		return InPtr != Buffer && Fallback.CanTransferAllocation(InPtr);
+	}
+
+	GLX_FORCE_INLINE GlxBool IsInline(const void* InPtr) const
+	{
+		return InPtr == Buffer;
+	}
+
+private:
+	alignas(InAlignment) GlxUInt8 Buffer[InInlineBytes > 0 ? InInlineBytes : 1];
+	GlxBool IsInlineInUse;
+	GLX_NO_UNIQUE_ADDRESS FallbackAllocatorType Fallback;
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Utils/NonCopyable.h"
+
+#include "MemoryUtils.h"
+
+#include <cstddef>
+
+// Bump allocator: allocations are carved linearly out of large blocks and are only reclaimed all at once by
+// Reset (keeps the blocks for reuse) or Release (returns them to the heap).
+class GlxArena : public GlxNonCopyable
+{
+public:
+	static GLX_CONSTEXPR GlxSizeT DefaultBlockSize = 64 * 1024;
+	static GLX_CONSTEXPR GlxSizeT DefaultAlignment = alignof(std::max_align_t);
+
+	explicit GlxArena(GlxSizeT InBlockSize = DefaultBlockSize)
+		: BlockSize(InBlockSize), FirstBlock(nullptr), CurrentBlock(nullptr), Cursor(nullptr), End(nullptr)
+	{}
+
+	~GlxArena()
+	{
+		Release();
+	}
+
+	void* Allocate(GlxSizeT InSize, GlxSizeT InAlignment = DefaultAlignment)
+	{
+		GLX_ASSERT(InAlignment > 0 && (InAlignment & (InAlignment - 1)) == 0);
+
+		GlxUInt8* Ptr = AlignPointer(Cursor, InAlignment);
+
+		if (!Cursor || Ptr + InSize > End)
+		{
+			AdvanceBlock(InSize + InAlignment);
+			Ptr = AlignPointer(Cursor, InAlignment);
+		}
+
+		Cursor = Ptr + InSize;
+		return Ptr;
+	}
+
+	// The most recent allocation is grown in place when the current block has room; anything else is copied.
+	void* Reallocate(void* InPtr, GlxSizeT InOldSize, GlxSizeT InNewSize, GlxSizeT InAlignment = DefaultAlignment)
+	{
+		GlxUInt8* Ptr = static_cast<GlxUInt8*>(InPtr);
+
+		if (Ptr && Ptr + InOldSize == Cursor && Ptr + InNewSize <= End)
+		{
+			Cursor = Ptr + InNewSize;
+			return Ptr;
+		}
+
+		void* NewPtr = Allocate(InNewSize, InAlignment);
+
+		if (Ptr)
+		{
+			GLX_MEMCPY(NewPtr, Ptr, InOldSize < InNewSize ? InOldSize : InNewSize);
+		}
+
+		return NewPtr;
+	}
+
+	void Reset()
+	{
+		CurrentBlock = FirstBlock;
+
+		if (CurrentBlock)
+		{
+			Cursor = CurrentBlock->GetData();
+			End = Cursor + CurrentBlock->Size;
+		}
+	}
+
+	void Release()
+	{
+		while (FirstBlock)
+		{
+			GlxBlock* Next = FirstBlock->Next;
+			GLX_FREE(FirstBlock);
+			FirstBlock = Next;
+		}
+
+		CurrentBlock = nullptr;
+		Cursor = nullptr;
+		End = nullptr;
+	}
+
+	GLX_FORCE_INLINE GlxSizeT GetBlockSize() const
+	{
+		return BlockSize;
+	}
+
+private:
+	class GlxBlock
+	{
+	public:
+		GLX_FORCE_INLINE GlxUInt8* GetData()
+		{
+			return reinterpret_cast<GlxUInt8*>(this + 1);
+		}
+
+		GlxBlock* Next;
+		GlxSizeT Size;
+	};
+
+	static GLX_FORCE_INLINE GlxUInt8* AlignPointer(GlxUInt8* InPtr, GlxSizeT InAlignment)
+	{
+		return reinterpret_cast<GlxUInt8*>((reinterpret_cast<GlxSizeT>(InPtr) + InAlignment - 1) & ~(static_cast<GlxSizeT>(InAlignment) - 1));
+	}
+
+	void AdvanceBlock(GlxSizeT InMinSize)
+	{
+		// Reuse the blocks kept by Reset before asking the heap for a new one.
+		GlxBlock* Block = CurrentBlock ? CurrentBlock->Next : FirstBlock;
+		GlxBlock* Prev = CurrentBlock;
+
+		while (Block && Block->Size < InMinSize)
+		{
+			Prev = Block;
+			Block = Block->Next;
+		}
+
+		if (!Block)
+		{
+			const GlxSizeT Size = InMinSize > BlockSize ? InMinSize : BlockSize;
+			Block = static_cast<GlxBlock*>(GLX_MALLOC(sizeof(GlxBlock) + Size));
+			Block->Size = Size;
+			Block->Next = nullptr;
+
+			if (Prev)
+			{
+				Block->Next = Prev->Next;
+				Prev->Next = Block;
+			}
+			else
+			{
+				FirstBlock = Block;
+			}
+		}
+
+		CurrentBlock = Block;
+		Cursor = Block->GetData();
+		End = Cursor + Block->Size;
+	}
+
+	GlxSizeT BlockSize;
+	GlxBlock* FirstBlock;
+	GlxBlock* CurrentBlock;
+	GlxUInt8* Cursor;
+	GlxUInt8* End;
+};
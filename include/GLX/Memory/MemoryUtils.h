@@ -18,6 +18,10 @@
 	#define GLX_FREE(...) free(__VA_ARGS__)
 #endif
 
+#if !defined(GLX_REALLOC)
+	#define GLX_REALLOC(...) realloc(__VA_ARGS__)
+#endif
+
 #if !defined(GLX_MEMCPY)
 	#define GLX_MEMCPY(...) memcpy(__VA_ARGS__)
 #endif
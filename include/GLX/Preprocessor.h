@@ -92,12 +92,30 @@
 			#define GLX_FALLTHROUGH
 		#endif
 	#endif
+
+	#if !defined(GLX_LIKELY)
+		#if GLX_HAS_CPP_ATTRIBUTE(likely)
+			#define GLX_LIKELY [[likely]]
+		#else
+			#define GLX_LIKELY
+		#endif
+	#endif
+
+	#if !defined(GLX_UNLIKELY)
+		#if GLX_HAS_CPP_ATTRIBUTE(unlikely)
+			#define GLX_UNLIKELY [[unlikely]]
+		#else
+			#define GLX_UNLIKELY
+		#endif
+	#endif
 #else
 	#define GLX_NODISCARD
 	#define GLX_NORETURN
 	#define GLX_DEPRECATED
 	#define GLX_MAYBE_UNUSED
 	#define GLX_FALLTHROUGH
+	#define GLX_LIKELY
+	#define GLX_UNLIKELY
 #endif
 
 #if __cpp_constexpr
@@ -171,6 +189,14 @@
 	#define GLX_RESTRICT
 #endif
 
+#if defined(GLX_COMPILER_MSVC)
+	#define GLX_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif defined(GLX_COMPILER_CLANG) || defined(GLX_COMPILER_GCC)
+	#define GLX_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#else
+	#define GLX_NO_UNIQUE_ADDRESS
+#endif
+
 #if defined(GLX_COMPILER_MSVC)
 	#define GLX_WARNING_PUSH __pragma(warning(push))
 	#define GLX_WARNING_POP __pragma(warning(pop))
@@ -246,6 +272,15 @@
 	#error "Unknown compiler"
 #endif
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// SIMD //////////////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(GLX_CPU_ARCH_X86) && !defined(GLX_DISABLE_SIMD)
+	#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define GLX_SIMD_SSE2
+	#endif
+#endif
+
 #if defined(GLX_DEBUG)
 	#if defined(GLX_COMPILER_MSVC)
 		#define GLX_DEBUG_BREAK __debugbreak()
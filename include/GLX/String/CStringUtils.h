@@ -26,6 +26,8 @@
 	#define GLX_WMEMCHR(...) wmemchr(__VA_ARGS__)
 #endif
 
+#include "StringSearch.h"
+
 template<typename TChar>
 class GlxCStringUtils
 {
@@ -167,27 +169,7 @@ public:
 			return nullptr;
 		}
 
-		if (*InSubstr == static_cast<CharType>(0))
-		{
-			return InStr;
-		}
-
-		SizeType SubstrLen = Strlen(InSubstr);
-		CharType FirstUpperSubstrChar = GlxCharUtils<CharType>::ToUpper(*InSubstr);
-
-		while (*InStr != static_cast<CharType>(0))
-		{
-			if (GlxCharUtils<CharType>::ToUpper(*InStr) == FirstUpperSubstrChar)
-			{
-				if (!Strnicmp(InStr, InSubstr, SubstrLen))
-				{
-					return InStr;
-				}
-			}
-
-			++InStr;
-		}
-		return nullptr;
+		return FindSubstr(InStr, InSubstr, false, true);
 	}
 
 	static const CharType* Strrstr(const CharType* InStr, const CharType* InSubstr)
@@ -197,29 +179,7 @@ public:
 			return nullptr;
 		}
 
-		if (*InSubstr == static_cast<CharType>(0))
-		{
-			return InStr + Strlen(InStr);
-		}
-
-		SizeType StrLen = Strlen(InStr);
-		SizeType SubstrLen = Strlen(InSubstr);
-
-		if (StrLen >= SubstrLen)
-		{
-			for (const CharType* Tmp = InStr + (StrLen - SubstrLen); Tmp >= InStr; --Tmp)
-			{
-				if (*Tmp == *InSubstr)
-				{
-					if (!Strncmp(Tmp, InSubstr, SubstrLen))
-					{
-						return Tmp;
-					}
-				}
-			}
-		}
-
-		return nullptr;
+		return FindSubstr(InStr, InSubstr, true, false);
 	}
 
 	static const CharType* Strristr(const CharType* InStr, const CharType* InSubstr)
@@ -229,31 +189,7 @@ public:
 			return nullptr;
 		}
 
-		if (*InSubstr == static_cast<CharType>(0))
-		{
-			return InStr + Strlen(InStr);
-		}
-
-		SizeType StrLen = Strlen(InStr);
-		SizeType SubstrLen = Strlen(InSubstr);
-
-		if (StrLen >= SubstrLen)
-		{
-			CharType FirstUpperSubstrChar = GlxCharUtils<CharType>::ToUpper(*InSubstr);
-
-			for (const CharType* Tmp = InStr + (StrLen - SubstrLen); Tmp >= InStr; --Tmp)
-			{
-				if (GlxCharUtils<CharType>::ToUpper(*Tmp) == FirstUpperSubstrChar)
-				{
-					if (!Strnicmp(Tmp, InSubstr, SubstrLen))
-					{
-						return Tmp;
-					}
-				}
-			}
-		}
-
-		return nullptr;
+		return FindSubstr(InStr, InSubstr, true, true);
 	}
 
 	static CharType* Strupr(CharType* InStr)
@@ -301,4 +237,16 @@ public:
 		}
 		return InStr;
 	}
+
+private:
+	static const CharType* FindSubstr(const CharType* InStr, const CharType* InSubstr, GlxBool InLast, GlxBool InIgnoreCase)
+	{
+		using SearchType = GlxStringSearch<CharType>;
+
+		const GlxInt64 StrLen = static_cast<GlxInt64>(Strlen(InStr));
+		const GlxInt64 SubstrLen = static_cast<GlxInt64>(Strlen(InSubstr));
+
+		const GlxInt64 Pos = InLast ? SearchType::FindLast(InStr, StrLen, InSubstr, SubstrLen, InIgnoreCase) : SearchType::Find(InStr, StrLen, InSubstr, SubstrLen, InIgnoreCase);
+		return Pos != GLX_INVALID_INDEX ? InStr + Pos : nullptr;
+	}
 };
@@ -0,0 +1,287 @@
+#pragma once
+
+#include "String.h"
+#include "GLX/Containers/HashMap.h"
+#include "GLX/Memory/Arena.h"
+#include "GLX/Threading/ReadWriteLock.h"
+#include "GLX/Utils/HashFunctions.h"
+
+namespace GlxNsPrivate
+{
+	// Global table of interned names. Entries are never removed, so an index stays valid for the life of the program
+	// and the characters, which live in an arena, never move. Lookups only take the read lock; adding a name takes the
+	// write lock.
+	class GlxNameTable : public GlxNonCopyable
+	{
+	public:
+		using SizeType = GlxInt64;
+
+		static GLX_CONSTEXPR SizeType MaxNameLength = 1023;
+		static GLX_CONSTEXPR GlxUInt32 EntriesPerBlock = 1u << 14;
+		static GLX_CONSTEXPR GlxUInt32 MaxBlocks = 1u << 10;
+
+		class GlxEntry
+		{
+		public:
+			const GlxChar* Data;
+			SizeType Length;
+		};
+
+		// Intentionally leaked so names stay usable while other statics are being destroyed.
+		static GlxNameTable& Get()
+		{
+			static GlxNameTable* Table = new GlxNameTable();
+			return *Table;
+		}
+
+		// Returns None (0) for names longer than MaxNameLength, and once the table is full.
+		GlxUInt32 FindOrAdd(const GlxChar* InStr, SizeType InLength)
+		{
+			GLX_ASSERT(InLength >= 0);
+
+			if (InLength <= 0 || InLength > MaxNameLength)
+			{
+				return 0;
+			}
+
+			const GlxUInt64 Hash = HashFolded(InStr, InLength);
+			GlxUInt64 FreeProbe;
+			GlxUInt32 Index;
+
+			{
+				GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Lock);
+
+				if (FindLocked(Hash, InStr, InLength, Index, FreeProbe))
+				{
+					return Index;
+				}
+			}
+
+			GlxScopedWriteLock<GlxReadWriteLock> ScopedLock(Lock);
+
+			// Another thread may have added it between the two locks.
+			if (FindLocked(Hash, InStr, InLength, Index, FreeProbe))
+			{
+				return Index;
+			}
+
+			if (EntryCount >= EntriesPerBlock * MaxBlocks)
+			{
+				return 0;
+			}
+
+			GlxChar* Data = static_cast<GlxChar*>(Arena.Allocate((InLength + 1) * sizeof(GlxChar), alignof(GlxChar)));
+			GLX_MEMCPY(Data, InStr, InLength * sizeof(GlxChar));
+			Data[InLength] = static_cast<GlxChar>(0);
+
+			Index = EntryCount;
+			GlxEntry*& Block = Blocks[Index / EntriesPerBlock];
+
+			if (!Block)
+			{
+				Block = static_cast<GlxEntry*>(Arena.Allocate(EntriesPerBlock * sizeof(GlxEntry), alignof(GlxEntry)));
+			}
+
+			Block[Index % EntriesPerBlock] = GlxEntry{ Data, InLength };
+			++EntryCount;
+
+			Indices.Emplace(FreeProbe, Index);
+			return Index;
+		}
+
+		GlxUInt32 Find(const GlxChar* InStr, SizeType InLength) const
+		{
+			if (InLength == 0 || InLength > MaxNameLength)
+			{
+				return 0;
+			}
+
+			GlxUInt64 FreeProbe;
+			GlxUInt32 Index;
+
+			GlxScopedReadLock<GlxReadWriteLock> ScopedLock(Lock);
+			return FindLocked(HashFolded(InStr, InLength), InStr, InLength, Index, FreeProbe) ? Index : 0;
+		}
+
+		// Callers only hold indices handed out after the entry was written, so no lock is needed here.
+		GLX_FORCE_INLINE const GlxEntry& GetEntry(GlxUInt32 InIndex) const
+		{
+			return Blocks[InIndex / EntriesPerBlock][InIndex % EntriesPerBlock];
+		}
+
+	private:
+		// The hashes are already xxHash values; the map only needs to spread them over its buckets.
+		class GlxProbeHasher
+		{
+		public:
+			static GLX_FORCE_INLINE GlxSizeT GetHashCode(GlxUInt64 InHash)
+			{
+				return static_cast<GlxSizeT>(InHash);
+			}
+		};
+
+		GlxNameTable()
+			: Arena(256 * 1024), EntryCount(1)
+		{
+			static const GlxChar None[] = "";
+
+			Blocks[0] = static_cast<GlxEntry*>(Arena.Allocate(EntriesPerBlock * sizeof(GlxEntry), alignof(GlxEntry)));
+			Blocks[0][0] = GlxEntry{ None, 0 };
+		}
+
+		// Folds into a fixed buffer; longer names are fed to a streaming state a chunk at a time, which gives the same
+		// value as hashing the whole folded string at once.
+		static GlxUInt64 HashFolded(const GlxChar* InStr, SizeType InLength)
+		{
+			GLX_CONSTEXPR SizeType ChunkLength = 256;
+			GlxChar Folded[ChunkLength];
+
+			if (InLength <= ChunkLength)
+			{
+				for (SizeType Index = 0; Index < InLength; ++Index)
+				{
+					Folded[Index] = GlxFoldCase(InStr[Index]);
+				}
+
+				return XXH3_64bits(Folded, static_cast<GlxSizeT>(InLength) * sizeof(GlxChar));
+			}
+
+			GlxHashState State;
+
+			for (SizeType Offset = 0; Offset < InLength; Offset += ChunkLength)
+			{
+				const SizeType Count = GLX_MIN(ChunkLength, InLength - Offset);
+
+				for (SizeType Index = 0; Index < Count; ++Index)
+				{
+					Folded[Index] = GlxFoldCase(InStr[Offset + Index]);
+				}
+
+				State.Update(Folded, static_cast<GlxSizeT>(Count) * sizeof(GlxChar));
+			}
+
+			return State.Finalize();
+		}
+
+		// Names whose folded hashes collide are chained by re-probing with a remixed hash, so the map (which identifies
+		// keys by hash) never merges two different names.
+		GlxBool FindLocked(GlxUInt64 InHash, const GlxChar* InStr, SizeType InLength, GlxUInt32& OutIndex, GlxUInt64& OutFreeProbe) const
+		{
+			for (GlxUInt64 Probe = InHash;; Probe = Probe * 0x9E3779B97F4A7C15ull + 1)
+			{
+				const auto* Node = Indices.Find(Probe);
+
+				if (!Node)
+				{
+					OutFreeProbe = Probe;
+					return false;
+				}
+
+				const GlxEntry& Entry = GetEntry(Node->Element.Value);
+
+				if (Entry.Length == InLength && GlxStringSearch<GlxChar>::EqualsIgnoreCase(Entry.Data, InStr, InLength))
+				{
+					OutIndex = Node->Element.Value;
+					return true;
+				}
+			}
+		}
+
+		mutable GlxReadWriteLock Lock;
+		GlxArena Arena;
+		GlxHashMap<GlxUInt64, GlxUInt32, GlxProbeHasher> Indices;
+		GlxEntry* Blocks[MaxBlocks] = {};
+		GlxUInt32 EntryCount;
+	};
+}
+
+// Interned, case-insensitive identifier. A name is a 4-byte index into the global name table, so copying, comparing
+// and hashing are O(1) regardless of length. Names that differ only in case are the same name; the text keeps the
+// spelling it was first created with. The default name is None (the empty string).
+class GlxName
+{
+public:
+	using SizeType = GlxInt64;
+
+	GLX_CONSTEXPR GlxName()
+		: Index(0)
+	{}
+
+	// Strings longer than GlxNsPrivate::GlxNameTable::MaxNameLength give None.
+	GlxName(GlxStringView InStr)
+		: Index(GlxNsPrivate::GlxNameTable::Get().FindOrAdd(InStr.GetData(), InStr.GetElementCount()))
+	{}
+
+	GlxName(const GlxChar* InStr)
+		: GlxName(GlxStringView(InStr))
+	{}
+
+	GlxName(const GlxString& InStr)
+		: GlxName(GlxStringView(InStr))
+	{}
+
+	GlxName(const GlxName&) = default;
+	GlxName& operator=(const GlxName&) = default;
+
+	// Looks a name up without adding it; returns None if it was never created.
+	GLX_NODISCARD static GlxName Find(GlxStringView InStr)
+	{
+		GlxName Name;
+		Name.Index = GlxNsPrivate::GlxNameTable::Get().Find(InStr.GetData(), InStr.GetElementCount());
+		return Name;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsNone() const
+	{
+		return Index == 0;
+	}
+
+	GLX_FORCE_INLINE GlxUInt32 GetIndex() const
+	{
+		return Index;
+	}
+
+	// The returned view is null-terminated and stays valid for the life of the program.
+	GLX_FORCE_INLINE GlxStringView ToStringView() const
+	{
+		const GlxNsPrivate::GlxNameTable::GlxEntry& Entry = GlxNsPrivate::GlxNameTable::Get().GetEntry(Index);
+		return GlxStringView(Entry.Data, Entry.Length);
+	}
+
+	GLX_FORCE_INLINE GlxString ToString() const
+	{
+		return ToStringView().ToString();
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator==(GlxName InLhs, GlxName InRhs)
+	{
+		return InLhs.Index == InRhs.Index;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator!=(GlxName InLhs, GlxName InRhs)
+	{
+		return InLhs.Index != InRhs.Index;
+	}
+
+	// Orders by creation, not alphabetically; use ToStringView().Compare() for lexical order.
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator<(GlxName InLhs, GlxName InRhs)
+	{
+		return InLhs.Index < InRhs.Index;
+	}
+
+private:
+	GlxUInt32 Index;
+};
+
+static_assert(sizeof(GlxName) == 4, "The size of GlxName must be equal to 4.");
+
+template<>
+class GlxHasher<GlxName>
+{
+public:
+	// Indices are dense, so a multiplicative mix is enough to spread them.
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(GlxName InName)
+	{
+		return static_cast<GlxSizeT>(InName.GetIndex() * 0x9E3779B97F4A7C15ull);
+	}
+};
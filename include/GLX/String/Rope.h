@@ -0,0 +1,568 @@
+#pragma once
+
+#include "String.h"
+
+// Text stored as an implicit treap of chunks. Every node holds up to LeafCapacity characters plus the length of its
+// subtree, so a position is found, split off or joined in expected O(log n) no matter how large the text is. Small
+// inserts are copied into the chunk they land in when it has room, and removals inside one chunk are done in place,
+// which keeps typing-style edits cheap. Wherever a cut is joined back, the chunks meeting there are combined if they fit
+// in one, so repeated edits do not leave a trail of small chunks behind.
+template<typename TChar>
+class GlxBasicRope
+{
+public:
+	using SizeType = GlxInt64;
+
+	using ElementType = TChar;
+	using ConstPointerType = const TChar*;
+
+	using StringType = GlxBasicString<TChar>;
+	using ViewType = GlxBasicStringView<TChar>;
+
+	static GLX_CONSTEXPR SizeType LeafCapacity = 512;
+
+	GlxBasicRope() = default;
+
+	explicit GlxBasicRope(ViewType InStr)
+	{
+		Append(InStr);
+	}
+
+	GlxBasicRope(const GlxBasicRope& InOther)
+		: Root(Clone(InOther.Root)), Seed(InOther.Seed)
+	{}
+
+	GlxBasicRope(GlxBasicRope&& InOther) noexcept
+		: Root(InOther.Root), Seed(InOther.Seed)
+	{
+		InOther.Root = nullptr;
+	}
+
+	GlxBasicRope& operator=(const GlxBasicRope& InOther)
+	{
+		if (this != &InOther)
+		{
+			GlxNode* NewRoot = Clone(InOther.Root);
+			Destroy(Root);
+			Root = NewRoot;
+			Seed = InOther.Seed;
+		}
+		return *this;
+	}
+
+	GlxBasicRope& operator=(GlxBasicRope&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Destroy(Root);
+			Root = InOther.Root;
+			Seed = InOther.Seed;
+			InOther.Root = nullptr;
+		}
+		return *this;
+	}
+
+	~GlxBasicRope()
+	{
+		Destroy(Root);
+	}
+
+	GLX_FORCE_INLINE SizeType GetElementCount() const
+	{
+		return GetSize(Root);
+	}
+
+	GLX_FORCE_INLINE GlxBool IsEmpty() const
+	{
+		return Root == nullptr;
+	}
+
+	ElementType operator[](SizeType InIndex) const
+	{
+		GLX_ASSERT(InIndex >= 0 && InIndex < GetElementCount());
+
+		const GlxNode* Node = Root;
+
+		while (true)
+		{
+			const SizeType LeftSize = GetSize(Node->Left);
+
+			if (InIndex < LeftSize)
+			{
+				Node = Node->Left;
+			}
+			else if (InIndex < LeftSize + Node->Count)
+			{
+				return Node->Chars[InIndex - LeftSize];
+			}
+			else
+			{
+				InIndex -= LeftSize + Node->Count;
+				Node = Node->Right;
+			}
+		}
+	}
+
+	void Insert(SizeType InPos, ConstPointerType InStr, SizeType InLength)
+	{
+		GLX_ASSERT(InPos >= 0 && InPos <= GetElementCount() && InLength >= 0 && (InStr || InLength == 0));
+
+		if (InLength == 0 || (InLength <= LeafCapacity && InsertIntoChunk(Root, InPos, InStr, InLength)))
+		{
+			return;
+		}
+
+		GlxNode* Left;
+		GlxNode* Right;
+		Split(Root, InPos, Left, Right);
+		Root = Join(Join(Left, Build(InStr, InLength)), Right);
+
+		CoalesceAround(InPos);
+		CoalesceAround(InPos + InLength);
+	}
+
+	GLX_FORCE_INLINE void Insert(SizeType InPos, ViewType InStr)
+	{
+		Insert(InPos, InStr.GetData(), InStr.GetElementCount());
+	}
+
+	GLX_FORCE_INLINE void Append(ConstPointerType InStr, SizeType InLength)
+	{
+		Insert(GetElementCount(), InStr, InLength);
+	}
+
+	GLX_FORCE_INLINE void Append(ViewType InStr)
+	{
+		Insert(GetElementCount(), InStr.GetData(), InStr.GetElementCount());
+	}
+
+	void RemoveAt(SizeType InPos, SizeType InLength)
+	{
+		GLX_ASSERT(InPos >= 0 && InLength >= 0 && InPos + InLength <= GetElementCount());
+
+		if (InLength == 0)
+		{
+			return;
+		}
+
+		if (!RemoveFromChunk(Root, InPos, InLength))
+		{
+			GlxNode* Left;
+			GlxNode* Middle;
+			GlxNode* Right;
+			Split(Root, InPos, Left, Right);
+			Split(Right, InLength, Middle, Right);
+
+			Destroy(Middle);
+			Root = Join(Left, Right);
+		}
+
+		CoalesceAround(InPos);
+	}
+
+	void Clear()
+	{
+		Destroy(Root);
+		Root = nullptr;
+	}
+
+	// Copies InLength characters starting at InPos; only the chunks overlapping the range are visited.
+	GLX_NODISCARD StringType Substring(SizeType InPos, SizeType InLength) const
+	{
+		GLX_ASSERT(InPos >= 0 && InLength >= 0 && InPos + InLength <= GetElementCount());
+
+		StringType Result;
+		Result.Reserve(InLength);
+		CopyRange(Root, InPos, InPos + InLength, Result);
+		return Result;
+	}
+
+	// Joins the chunks into a string with a single allocation.
+	GLX_NODISCARD StringType Flatten() const
+	{
+		return Substring(0, GetElementCount());
+	}
+
+	// Calls InFunc(const TChar*, SizeType) for every chunk in order.
+	template<typename TFunc>
+	void ForEachChunk(TFunc&& InFunc) const
+	{
+		VisitChunks(Root, InFunc);
+	}
+
+private:
+	class GlxNode
+	{
+	public:
+		GlxNode* Left;
+		GlxNode* Right;
+		GlxUInt32 Priority;
+		SizeType Count;
+		SizeType Size;
+		ElementType Chars[LeafCapacity];
+	};
+
+	static GLX_FORCE_INLINE SizeType GetSize(const GlxNode* InNode)
+	{
+		return InNode ? InNode->Size : 0;
+	}
+
+	static GLX_FORCE_INLINE void UpdateSize(GlxNode* InNode)
+	{
+		InNode->Size = GetSize(InNode->Left) + InNode->Count + GetSize(InNode->Right);
+	}
+
+	static GlxNode* CreateNode(ConstPointerType InStr, SizeType InCount, GlxUInt32 InPriority)
+	{
+		GlxNode* Node = static_cast<GlxNode*>(GLX_MALLOC(sizeof(GlxNode)));
+		Node->Left = nullptr;
+		Node->Right = nullptr;
+		Node->Priority = InPriority;
+		Node->Count = InCount;
+		Node->Size = InCount;
+		GLX_MEMCPY(Node->Chars, InStr, InCount * sizeof(ElementType));
+		return Node;
+	}
+
+	static void Destroy(GlxNode* InNode)
+	{
+		if (InNode)
+		{
+			Destroy(InNode->Left);
+			Destroy(InNode->Right);
+			GLX_FREE(InNode);
+		}
+	}
+
+	static GlxNode* Clone(const GlxNode* InNode)
+	{
+		if (!InNode)
+		{
+			return nullptr;
+		}
+
+		GlxNode* Node = static_cast<GlxNode*>(GLX_MALLOC(sizeof(GlxNode)));
+		GLX_MEMCPY(Node, InNode, sizeof(GlxNode));
+		Node->Left = Clone(InNode->Left);
+		Node->Right = Clone(InNode->Right);
+		return Node;
+	}
+
+	GLX_FORCE_INLINE GlxUInt32 NextPriority()
+	{
+		Seed ^= Seed << 13;
+		Seed ^= Seed >> 17;
+		Seed ^= Seed << 5;
+		return Seed;
+	}
+
+	// Splits InNode into the first InPos characters and the rest, cutting a chunk in two when InPos falls inside it.
+	static void Split(GlxNode* InNode, SizeType InPos, GlxNode*& OutLeft, GlxNode*& OutRight)
+	{
+		if (!InNode)
+		{
+			OutLeft = OutRight = nullptr;
+			return;
+		}
+
+		const SizeType LeftSize = GetSize(InNode->Left);
+
+		if (InPos <= LeftSize)
+		{
+			Split(InNode->Left, InPos, OutLeft, InNode->Left);
+			UpdateSize(InNode);
+			OutRight = InNode;
+		}
+		else if (InPos >= LeftSize + InNode->Count)
+		{
+			Split(InNode->Right, InPos - LeftSize - InNode->Count, InNode->Right, OutRight);
+			UpdateSize(InNode);
+			OutLeft = InNode;
+		}
+		else
+		{
+			// The tail keeps the node's priority, so it stays above the right subtree it adopts.
+			const SizeType Offset = InPos - LeftSize;
+			GlxNode* Tail = CreateNode(InNode->Chars + Offset, InNode->Count - Offset, InNode->Priority);
+			Tail->Right = InNode->Right;
+			UpdateSize(Tail);
+
+			InNode->Right = nullptr;
+			InNode->Count = Offset;
+			UpdateSize(InNode);
+
+			OutLeft = InNode;
+			OutRight = Tail;
+		}
+	}
+
+	static GlxNode* Merge(GlxNode* InLeft, GlxNode* InRight)
+	{
+		if (!InLeft || !InRight)
+		{
+			return InLeft ? InLeft : InRight;
+		}
+
+		if (InLeft->Priority >= InRight->Priority)
+		{
+			InLeft->Right = Merge(InLeft->Right, InRight);
+			UpdateSize(InLeft);
+			return InLeft;
+		}
+
+		InRight->Left = Merge(InLeft, InRight->Left);
+		UpdateSize(InRight);
+		return InRight;
+	}
+
+	// Merges two treaps, first moving the leading chunk of InRight into the trailing chunk of InLeft if both fit in one.
+	static GlxNode* Join(GlxNode* InLeft, GlxNode* InRight)
+	{
+		if (InLeft && InRight)
+		{
+			GlxNode* Last = InLeft;
+			GlxNode* First = InRight;
+
+			while (Last->Right)
+			{
+				Last = Last->Right;
+			}
+
+			while (First->Left)
+			{
+				First = First->Left;
+			}
+
+			if (Last->Count + First->Count <= LeafCapacity)
+			{
+				GLX_MEMCPY(Last->Chars + Last->Count, First->Chars, First->Count * sizeof(ElementType));
+				Last->Count += First->Count;
+
+				for (GlxNode* Node = InLeft; Node; Node = Node->Right)
+				{
+					Node->Size += First->Count;
+				}
+
+				InRight = RemoveFirst(InRight);
+			}
+		}
+
+		return Merge(InLeft, InRight);
+	}
+
+	// Joins the chunks on either side of InPos with their neighbours if they have fallen below half a leaf, so the chunk
+	// count stays proportional to the text length however it was edited.
+	void CoalesceAround(SizeType InPos)
+	{
+		if (InPos > 0)
+		{
+			CoalesceChunk(InPos - 1);
+		}
+
+		if (InPos < GetElementCount())
+		{
+			CoalesceChunk(InPos);
+		}
+	}
+
+	void CoalesceChunk(SizeType InPos)
+	{
+		const GlxNode* Node = Root;
+		SizeType ChunkStart = 0;
+
+		while (true)
+		{
+			const SizeType LeftSize = GetSize(Node->Left);
+
+			if (InPos < LeftSize)
+			{
+				Node = Node->Left;
+			}
+			else if (InPos < LeftSize + Node->Count)
+			{
+				ChunkStart += LeftSize;
+				break;
+			}
+			else
+			{
+				ChunkStart += LeftSize + Node->Count;
+				InPos -= LeftSize + Node->Count;
+				Node = Node->Right;
+			}
+		}
+
+		if (Node->Count < LeafCapacity / 2)
+		{
+			const SizeType ChunkEnd = ChunkStart + Node->Count;
+			JoinAt(ChunkEnd);
+			JoinAt(ChunkStart);
+		}
+	}
+
+	// Cuts the rope at a chunk boundary and joins it back, combining the two chunks that meet there if they fit in one.
+	void JoinAt(SizeType InPos)
+	{
+		if (InPos > 0 && InPos < GetElementCount())
+		{
+			GlxNode* Left;
+			GlxNode* Right;
+			Split(Root, InPos, Left, Right);
+			Root = Join(Left, Right);
+		}
+	}
+
+	// Unlinks and frees the leftmost node of InNode's subtree; returns the new subtree root.
+	static GlxNode* RemoveFirst(GlxNode* InNode)
+	{
+		if (!InNode->Left)
+		{
+			GlxNode* Right = InNode->Right;
+			GLX_FREE(InNode);
+			return Right;
+		}
+
+		InNode->Left = RemoveFirst(InNode->Left);
+		UpdateSize(InNode);
+		return InNode;
+	}
+
+	GlxNode* Build(ConstPointerType InStr, SizeType InLength)
+	{
+		GlxNode* Result = nullptr;
+
+		for (SizeType Offset = 0; Offset < InLength; Offset += LeafCapacity)
+		{
+			const SizeType Count = (InLength - Offset < LeafCapacity) ? InLength - Offset : LeafCapacity;
+			Result = Merge(Result, CreateNode(InStr + Offset, Count, NextPriority()));
+		}
+
+		return Result;
+	}
+
+	static GlxBool InsertIntoChunk(GlxNode* InNode, SizeType InPos, ConstPointerType InStr, SizeType InLength)
+	{
+		if (!InNode)
+		{
+			return false;
+		}
+
+		const SizeType LeftSize = GetSize(InNode->Left);
+		GlxBool Inserted;
+
+		if (InPos < LeftSize)
+		{
+			Inserted = InsertIntoChunk(InNode->Left, InPos, InStr, InLength);
+		}
+		else if (InPos > LeftSize + InNode->Count)
+		{
+			Inserted = InsertIntoChunk(InNode->Right, InPos - LeftSize - InNode->Count, InStr, InLength);
+		}
+		else
+		{
+			if (InNode->Count + InLength > LeafCapacity)
+			{
+				return false;
+			}
+
+			ElementType* Dest = InNode->Chars + (InPos - LeftSize);
+			GLX_MEMMOVE(Dest + InLength, Dest, (LeftSize + InNode->Count - InPos) * sizeof(ElementType));
+			GLX_MEMCPY(Dest, InStr, InLength * sizeof(ElementType));
+			InNode->Count += InLength;
+			Inserted = true;
+		}
+
+		if (Inserted)
+		{
+			InNode->Size += InLength;
+		}
+		return Inserted;
+	}
+
+	// Removes the range in place if it lies inside a single chunk and leaves at least one character in it.
+	static GlxBool RemoveFromChunk(GlxNode* InNode, SizeType InPos, SizeType InLength)
+	{
+		if (!InNode)
+		{
+			return false;
+		}
+
+		const SizeType LeftSize = GetSize(InNode->Left);
+		GlxBool Removed;
+
+		if (InPos < LeftSize)
+		{
+			Removed = RemoveFromChunk(InNode->Left, InPos, InLength);
+		}
+		else if (InPos >= LeftSize + InNode->Count)
+		{
+			Removed = RemoveFromChunk(InNode->Right, InPos - LeftSize - InNode->Count, InLength);
+		}
+		else
+		{
+			const SizeType Offset = InPos - LeftSize;
+
+			if (Offset + InLength > InNode->Count || InLength >= InNode->Count)
+			{
+				return false;
+			}
+
+			ElementType* Dest = InNode->Chars + Offset;
+			GLX_MEMMOVE(Dest, Dest + InLength, (InNode->Count - Offset - InLength) * sizeof(ElementType));
+			InNode->Count -= InLength;
+			Removed = true;
+		}
+
+		if (Removed)
+		{
+			InNode->Size -= InLength;
+		}
+		return Removed;
+	}
+
+	// Appends the characters in [InBegin, InEnd) of InNode's subtree to OutStr.
+	static void CopyRange(const GlxNode* InNode, SizeType InBegin, SizeType InEnd, StringType& OutStr)
+	{
+		if (!InNode || InBegin >= InEnd)
+		{
+			return;
+		}
+
+		const SizeType LeftSize = GetSize(InNode->Left);
+		const SizeType ChunkEnd = LeftSize + InNode->Count;
+
+		if (InBegin < LeftSize)
+		{
+			CopyRange(InNode->Left, InBegin, InEnd < LeftSize ? InEnd : LeftSize, OutStr);
+		}
+
+		const SizeType From = InBegin > LeftSize ? InBegin : LeftSize;
+		const SizeType To = InEnd < ChunkEnd ? InEnd : ChunkEnd;
+
+		if (From < To)
+		{
+			OutStr.Append(InNode->Chars + (From - LeftSize), To - From);
+		}
+
+		if (InEnd > ChunkEnd)
+		{
+			CopyRange(InNode->Right, (InBegin > ChunkEnd ? InBegin : ChunkEnd) - ChunkEnd, InEnd - ChunkEnd, OutStr);
+		}
+	}
+
+	template<typename TFunc>
+	static void VisitChunks(const GlxNode* InNode, TFunc& InFunc)
+	{
+		if (InNode)
+		{
+			VisitChunks(InNode->Left, InFunc);
+			InFunc(static_cast<ConstPointerType>(InNode->Chars), InNode->Count);
+			VisitChunks(InNode->Right, InFunc);
+		}
+	}
+
+	GlxNode* Root = nullptr;
+	GlxUInt32 Seed = 0x9E3779B9u;
+};
+
+using GlxRope = GlxBasicRope<GlxChar>;
+using GlxWRope = GlxBasicRope<GlxWChar>;
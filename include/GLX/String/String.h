@@ -2,11 +2,18 @@
 
 #include "CStringUtils.h"
 #include "GLX/Containers/DynamicArray.h"
+#include "GLX/TypeTraits/IsBitwiseConstructible.h"
 #include "GLX/TypeTraits/IsStandardLayout.h"
 
 #include "../ThirdParty/fmt/core.h"
 #include "../ThirdParty/fmt/xchar.h"
 
+template<typename TChar>
+class GlxBasicStringView;
+
+template<typename TChar>
+class GlxStringTokenizer;
+
 template<typename TChar>
 class GlxBasicString
 {
@@ -26,6 +33,7 @@ public:
 
 	using CharUtils = GlxCharUtils<TChar>;
 	using CStringUtils = GlxCStringUtils<TChar>;
+	using StringSearch = GlxStringSearch<TChar>;
 
 	static GLX_CONSTEXPR SizeType InvalidIndex = GLX_INVALID_INDEX;
 	static GLX_CONSTEXPR GlxFloat GrowthFactor = 1.5f;
@@ -38,133 +46,253 @@ public:
 	static_assert(IsChar || IsWChar, "GlxBasicString<TChar> is not implemented for this char type.");
 
 private:
+	class GlxHeapStorage
+	{
+	public:
+		PointerType Data;
+		SizeType Length;
+		SizeType Capacity;
+	};
+
+	static GLX_CONSTEXPR SizeType StorageBytes = sizeof(GlxHeapStorage);
+	static GLX_CONSTEXPR SizeType InlineSlots = StorageBytes / sizeof(ElementType);
+	static GLX_CONSTEXPR GlxUInt8 InlineFlag = 0x80;
+
+public:
+	// Strings of up to InlineCapacity elements live inside the object (22 chars, or 10 wide chars where wchar_t is 2 bytes).
+	// The last slot is reserved: its last byte is the mode tag, InlineFlag | Length for inline strings. For heap strings
+	// that byte is the most significant byte of Heap.Capacity (little-endian), which stays 0.
+	static GLX_CONSTEXPR SizeType InlineCapacity = InlineSlots - 2;
+
+	static_assert(InlineSlots * sizeof(ElementType) == StorageBytes && InlineCapacity < InlineFlag);
+
+private:
+	GLX_FORCE_INLINE GlxUInt8 GetTag() const
+	{
+		static_assert(sizeof(GlxBasicString) == StorageBytes);
+		return reinterpret_cast<const GlxUInt8*>(this)[StorageBytes - 1];
+	}
+
+	GLX_FORCE_INLINE void SetInlineLength(SizeType InLength)
+	{
+		reinterpret_cast<GlxUInt8*>(this)[StorageBytes - 1] = static_cast<GlxUInt8>(InlineFlag | InLength);
+	}
+
+	GLX_FORCE_INLINE void SetHeapStorage(PointerType InData, SizeType InCapacity)
+	{
+		GLX_ASSERT(InCapacity < (static_cast<SizeType>(1) << 56));
+		Heap.Data = InData;
+		Heap.Capacity = InCapacity;
+	}
+
+	// Updates the length in the current mode and writes the terminator.
+	GLX_FORCE_INLINE void SetLength(SizeType InLength)
+	{
+		if (IsInline())
+		{
+			SetInlineLength(InLength);
+			Inline[InLength] = NullChar;
+		}
+		else
+		{
+			Heap.Length = InLength;
+			Heap.Data[InLength] = NullChar;
+		}
+	}
+
+	static GLX_FORCE_INLINE void Fill(PointerType InDest, ElementType InCh, SizeType InCount)
+	{
+		if constexpr (IsChar)
+		{
+			GLX_MEMSET(InDest, InCh, InCount);
+		}
+		else if constexpr (IsWChar)
+		{
+			GLX_WMEMSET(InDest, InCh, InCount);
+		}
+	}
+
+	// Sets up empty storage for InLength elements and writes the terminator; the caller fills in the elements.
+	PointerType InitializeStorage(SizeType InLength)
+	{
+		if (InLength <= InlineCapacity)
+		{
+			SetInlineLength(InLength);
+			Inline[InLength] = NullChar;
+			return Inline;
+		}
+
+		SetHeapStorage(static_cast<PointerType>(GLX_MALLOC((InLength + 1) * sizeof(ElementType))), InLength);
+		Heap.Length = InLength;
+		Heap.Data[InLength] = NullChar;
+		return Heap.Data;
+	}
+
 	void Initialize(SizeType InLength, ConstPointerType InStr)
 	{
-		Data = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
+		PointerType Dest = InitializeStorage(InLength);
 
 		if (InLength > 0 && InStr)
 		{
-			GLX_MEMCPY(Data, InStr, InLength * sizeof(ElementType));
+			GLX_MEMCPY(Dest, InStr, InLength * sizeof(ElementType));
 		}
-
-		Data[InLength] = NullChar;
 	}
 
 	void Initialize(SizeType InCount, ElementType InCh)
 	{
-		Data = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
+		PointerType Dest = InitializeStorage(InCount);
 
 		if (InCount > 0)
 		{
-			if constexpr (IsChar)
-			{
-				GLX_MEMSET(Data, InCh, InCount);
-			}
-			else if constexpr (IsWChar)
+			Fill(Dest, InCh, InCount);
+		}
+	}
+
+	// Changes the capacity while keeping the elements, moving them between inline and heap storage as needed.
+	void Reallocate(SizeType InNewCapacity)
+	{
+		const SizeType CurLength = GetElementCount();
+		GLX_ASSERT(InNewCapacity >= CurLength);
+
+		if (InNewCapacity <= InlineCapacity)
+		{
+			if (!IsInline())
 			{
-				GLX_WMEMSET(Data, InCh, InCount);
+				PointerType OldData = Heap.Data;
+				GLX_MEMCPY(Inline, OldData, CurLength * sizeof(ElementType));
+				GLX_FREE(OldData);
+
+				SetInlineLength(CurLength);
+				Inline[CurLength] = NullChar;
 			}
+			return;
 		}
 
-		Data[InCount] = NullChar;
+		PointerType NewData;
+
+		if (IsInline())
+		{
+			NewData = static_cast<PointerType>(GLX_MALLOC((InNewCapacity + 1) * sizeof(ElementType)));
+			GLX_MEMCPY(NewData, Inline, (CurLength + 1) * sizeof(ElementType));
+		}
+		else
+		{
+			NewData = static_cast<PointerType>(GLX_REALLOC(Heap.Data, (InNewCapacity + 1) * sizeof(ElementType)));
+		}
+
+		SetHeapStorage(NewData, InNewCapacity);
+		Heap.Length = CurLength;
+	}
+
+	// Grows the capacity by the growth factor to fit InAddedCount more elements. InSource may point into this string
+	// (e.g. s.Append(s)); the returned pointer is InSource rebased onto the new storage.
+	ConstPointerType Grow(SizeType InAddedCount, ConstPointerType InSource = nullptr)
+	{
+		ConstPointerType OldData = GetData();
+		const GlxBool IsSourceInside = InSource >= OldData && InSource <= OldData + GetElementCount();
+		const SizeType SourceOffset = IsSourceInside ? static_cast<SizeType>(InSource - OldData) : 0;
+
+		Reallocate(static_cast<SizeType>(GetCapacity() * GrowthFactor + InAddedCount));
+
+		return IsSourceInside ? GetData() + SourceOffset : InSource;
 	}
 
 	GLX_FORCE_INLINE GlxBasicString(SizeType InLength)
-		: Data(static_cast<PointerType>(GLX_MALLOC((InLength + 1) * sizeof(ElementType)))), Length(InLength), Capacity(InLength)
 	{
-		Data[InLength] = NullChar;
+		InitializeStorage(InLength);
 	}
 
 public:
 	GlxBasicString(GlxNullPtr) = delete;
 
-	GlxBasicString()
-		: Data(static_cast<PointerType>(GLX_MALLOC(sizeof(ElementType)))), Length(0), Capacity(0)
+	GlxBasicString() noexcept
 	{
-		*Data = NullChar;
+		InitializeStorage(0);
 	}
 
 	GlxBasicString(const GlxBasicString& InStr)
-		: Length(InStr.Length), Capacity(InStr.Length)
 	{
-		Initialize(Length, InStr.Data);
+		if (InStr.IsInline())
+		{
+			GLX_MEMCPY(Inline, InStr.Inline, StorageBytes);
+		}
+		else
+		{
+			Initialize(InStr.Heap.Length, InStr.Heap.Data);
+		}
 	}
 
 	GlxBasicString(const GlxBasicString& InStr, SizeType InStartPos, SizeType InLength)
 	{
-		GLX_ASSERT(InStartPos >= 0 && InLength >= 0 && InStartPos + InLength <= InStr.Length);
-		Length = InLength;
-		Capacity = InLength;
-		Initialize(Length, InStr.Data + InStartPos);
+		GLX_ASSERT(InStartPos >= 0 && InLength >= 0 && InStartPos + InLength <= InStr.GetElementCount());
+		Initialize(InLength, InStr.GetData() + InStartPos);
 	}
 
+	// Steals the heap block, or copies the inline bytes; the source is left as an empty inline string.
 	GlxBasicString(GlxBasicString&& InStr) noexcept
-		: Data(InStr.Data), Length(InStr.Length), Capacity(InStr.Capacity)
 	{
-		InStr.Data = static_cast<PointerType>(GLX_MALLOC(sizeof(ElementType)));
-		InStr.Length = 0;
-		InStr.Capacity = 0;
-		*InStr.Data = NullChar;
+		GLX_MEMCPY(Inline, InStr.Inline, StorageBytes);
+		InStr.InitializeStorage(0);
 	}
 
 	GlxBasicString(ConstPointerType InStr)
-		: Length(static_cast<SizeType>(CStringUtils::Strlen(InStr))), Capacity(Length)
 	{
-		Initialize(Length, InStr);
+		Initialize(static_cast<SizeType>(CStringUtils::Strlen(InStr)), InStr);
 	}
 
 	GlxBasicString(ConstPointerType InStr, SizeType InLength)
 	{
 		GLX_ASSERT(InLength >= 0);
-		Length = InLength;
-		Capacity = InLength;
 		Initialize(InLength, InStr);
 	}
 
 	GlxBasicString(ElementType InCh, SizeType InCount)
 	{
 		GLX_ASSERT(InCount >= 0);
-		Length = InCount;
-		Capacity = InCount;
 		Initialize(InCount, InCh);
 	}
 
 	~GlxBasicString()
 	{
-		Release();
+		if (!IsInline())
+		{
+			GLX_FREE(Heap.Data);
+		}
 	}
 
+	// Frees the heap block, if any, and leaves an empty inline string.
 	void Release()
 	{
-		if (Data)
+		if (!IsInline())
 		{
-			GLX_FREE(Data);
-			Data = nullptr;
-			Length = 0;
-			Capacity = 0;
+			GLX_FREE(Heap.Data);
 		}
+
+		InitializeStorage(0);
 	}
 
 	void Assign(ConstPointerType InStr, SizeType InLength)
 	{
 		GLX_ASSERT(InLength >= 0);
 
-		if (InLength > Capacity)
+		if (InLength > GetCapacity())
 		{
-			Capacity = InLength;
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
+			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((InLength + 1) * sizeof(ElementType)));
 			GLX_MEMCPY(NewData, InStr, InLength * sizeof(ElementType));
 
-			GLX_FREE(Data);
-			Data = NewData;
+			if (!IsInline())
+			{
+				GLX_FREE(Heap.Data);
+			}
+
+			SetHeapStorage(NewData, InLength);
 		}
 		else
 		{
-			GLX_MEMCPY(Data, InStr, InLength * sizeof(ElementType));
+			GLX_MEMMOVE(GetData(), InStr, InLength * sizeof(ElementType));
 		}
 
-		Data[InLength] = NullChar;
-		Length = InLength;
+		SetLength(InLength);
 	}
 
 	GlxBasicString& operator=(GlxNullPtr) = delete;
@@ -173,7 +301,7 @@ public:
 	{
 		if (this != &InStr)
 		{
-			Assign(InStr.Data, InStr.Length);
+			Assign(InStr.GetData(), InStr.GetElementCount());
 		}
 		return *this;
 	}
@@ -182,158 +310,167 @@ public:
 	{
 		if (this != &InStr)
 		{
-			PointerType TmpData = Data;
-			Data = InStr.Data;
-			InStr.Data = TmpData;
-
-			SizeType TmpCapacity = Capacity;
-			Capacity = InStr.Capacity;
-			InStr.Capacity = TmpCapacity;
-
-			Length = InStr.Length;
+			if (!IsInline())
+			{
+				GLX_FREE(Heap.Data);
+			}
 
-			InStr.Length = 0;
-			*InStr.Data = NullChar;
+			GLX_MEMCPY(Inline, InStr.Inline, StorageBytes);
+			InStr.InitializeStorage(0);
 		}
 		return *this;
 	}
 
+	// Exchanges the raw 24 bytes: neither representation holds a pointer into the object itself.
+	void Swap(GlxBasicString& InOther) noexcept
+	{
+		ElementType Tmp[InlineSlots];
+		GLX_MEMCPY(Tmp, Inline, StorageBytes);
+		GLX_MEMCPY(Inline, InOther.Inline, StorageBytes);
+		GLX_MEMCPY(InOther.Inline, Tmp, StorageBytes);
+	}
+
 	GlxBasicString& operator=(ConstPointerType InStr)
 	{
-		if (Data != InStr)
+		if (GetData() != InStr)
 		{
 			Assign(InStr, static_cast<SizeType>(CStringUtils::Strlen(InStr)));
 		}
 		return *this;
 	}
 
+	GLX_FORCE_INLINE GlxBool IsInline() const
+	{
+		return (GetTag() & InlineFlag) != 0;
+	}
+
 	GLX_FORCE_INLINE SizeType GetElementCount() const
 	{
-		return Length;
+		return IsInline() ? static_cast<SizeType>(GetTag() & ~InlineFlag) : Heap.Length;
 	}
 
 	GLX_FORCE_INLINE SizeType GetCapacity() const
 	{
-		return Capacity;
+		return IsInline() ? InlineCapacity : Heap.Capacity;
 	}
 
 	GLX_FORCE_INLINE SizeType GetRemainingCapacity() const
 	{
-		return Capacity - Length;
+		return GetCapacity() - GetElementCount();
 	}
 
 	GLX_FORCE_INLINE PointerType GetData()
 	{
-		return Data;
+		return IsInline() ? Inline : Heap.Data;
 	}
 
 	GLX_FORCE_INLINE ConstPointerType GetData() const
 	{
-		return Data;
+		return IsInline() ? Inline : Heap.Data;
 	}
 
 	GLX_FORCE_INLINE GlxBool IsEmpty() const
 	{
-		return Length == 0;
+		return GetElementCount() == 0;
 	}
 
 	GLX_FORCE_INLINE ReferenceType CharAt(SizeType InIndex)
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex < Length);
-		return Data[InIndex];
+		GLX_ASSERT(InIndex >= 0 && InIndex < GetElementCount());
+		return GetData()[InIndex];
 	}
 
 	GLX_FORCE_INLINE ConstReferenceType CharAt(SizeType InIndex) const
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex < Length);
-		return Data[InIndex];
+		GLX_ASSERT(InIndex >= 0 && InIndex < GetElementCount());
+		return GetData()[InIndex];
 	}
 
 	GLX_FORCE_INLINE ReferenceType operator[](SizeType InIndex)
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex < Length);
-		return Data[InIndex];
+		GLX_ASSERT(InIndex >= 0 && InIndex < GetElementCount());
+		return GetData()[InIndex];
 	}
 
 	GLX_FORCE_INLINE ConstReferenceType operator[](SizeType InIndex) const
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex < Length);
-		return Data[InIndex];
+		GLX_ASSERT(InIndex >= 0 && InIndex < GetElementCount());
+		return GetData()[InIndex];
 	}
 
 	GLX_FORCE_INLINE ReferenceType GetFirstElement()
 	{
-		GLX_ASSERT(Length > 0);
-		return *Data;
+		GLX_ASSERT(GetElementCount() > 0);
+		return *GetData();
 	}
 
 	GLX_FORCE_INLINE ConstReferenceType GetFirstElement() const
 	{
-		GLX_ASSERT(Length > 0);
-		return *Data;
+		GLX_ASSERT(GetElementCount() > 0);
+		return *GetData();
 	}
 
 	GLX_FORCE_INLINE ReferenceType GetLastElement()
 	{
-		GLX_ASSERT(Length > 0);
-		return Data[Length - 1];
+		GLX_ASSERT(GetElementCount() > 0);
+		return GetData()[GetElementCount() - 1];
 	}
 
 	GLX_FORCE_INLINE ConstReferenceType GetLastElement() const
 	{
-		GLX_ASSERT(Length > 0);
-		return Data[Length - 1];
+		GLX_ASSERT(GetElementCount() > 0);
+		return GetData()[GetElementCount() - 1];
 	}
 
 	GLX_FORCE_INLINE IteratorType begin()
 	{
-		return IteratorType(Data);
+		return IteratorType(GetData());
 	}
 
 	GLX_FORCE_INLINE ConstIteratorType begin() const
 	{
-		return ConstIteratorType(Data);
+		return ConstIteratorType(GetData());
 	}
 
 	GLX_FORCE_INLINE ConstIteratorType cbegin() const
 	{
-		return ConstIteratorType(Data);
+		return ConstIteratorType(GetData());
 	}
 
 	GLX_FORCE_INLINE IteratorType end()
 	{
-		return IteratorType(Data + Length);
+		return IteratorType(GetData() + GetElementCount());
 	}
 
 	GLX_FORCE_INLINE ConstIteratorType end() const
 	{
-		return ConstIteratorType(Data + Length);
+		return ConstIteratorType(GetData() + GetElementCount());
 	}
 
 	GLX_FORCE_INLINE ConstIteratorType cend() const
 	{
-		return ConstIteratorType(Data + Length);
+		return ConstIteratorType(GetData() + GetElementCount());
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool Equals(ConstPointerType InStr, GlxBool InIgnoreCase = false) const
 	{
 		if (InIgnoreCase)
 		{
-			return CStringUtils::Stricmp(Data, InStr) == 0;
+			return CStringUtils::Stricmp(GetData(), InStr) == 0;
 		}
-		return CStringUtils::Strcmp(Data, InStr) == 0;
+		return CStringUtils::Strcmp(GetData(), InStr) == 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool Equals(const GlxBasicString& InStr, GlxBool InIgnoreCase = false) const
 	{
-		if (Length == InStr.Length)
+		if (GetElementCount() == InStr.GetElementCount())
 		{
 			if (InIgnoreCase)
 			{
-				return CStringUtils::Stricmp(Data, InStr.Data) == 0;
+				return CStringUtils::Stricmp(GetData(), InStr.GetData()) == 0;
 			}
 
-			return CStringUtils::Strcmp(Data, InStr.Data) == 0;
+			return CStringUtils::Strcmp(GetData(), InStr.GetData()) == 0;
 		}
 		return false;
 	}
@@ -342,27 +479,27 @@ public:
 	{
 		if (InIgnoreCase)
 		{
-			return CStringUtils::Stricmp(Data, InStr);
+			return CStringUtils::Stricmp(GetData(), InStr);
 		}
-		return CStringUtils::Strcmp(Data, InStr);
+		return CStringUtils::Strcmp(GetData(), InStr);
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxInt32 Compare(const GlxBasicString& InStr, GlxBool InIgnoreCase = false) const
 	{
 		if (InIgnoreCase)
 		{
-			return CStringUtils::Stricmp(Data, InStr.Data);
+			return CStringUtils::Stricmp(GetData(), InStr.GetData());
 		}
 
-		return CStringUtils::Strcmp(Data, InStr.Data);
+		return CStringUtils::Strcmp(GetData(), InStr.GetData());
 	}
 
 	GLX_NODISCARD GlxInt32 Compare(SizeType InLhsStartPos, SizeType InLhsLength, const GlxBasicString& InRhs, SizeType InRhsStartPos, SizeType InRhsLength, GlxBool InIgnoreCase = false) const
 	{
-		GLX_ASSERT((InLhsStartPos >= 0 && InLhsStartPos + InLhsLength <= Length) && (InRhsStartPos >= 0 && InRhsStartPos + InRhsLength <= InRhs.Length));
+		GLX_ASSERT((InLhsStartPos >= 0 && InLhsStartPos + InLhsLength <= GetElementCount()) && (InRhsStartPos >= 0 && InRhsStartPos + InRhsLength <= InRhs.GetElementCount()));
 
-		PointerType LhsPtr = Data + InLhsStartPos;
-		PointerType RhsPtr = InRhs.Data + InRhsStartPos;
+		PointerType LhsPtr = GetData() + InLhsStartPos;
+		PointerType RhsPtr = InRhs.GetData() + InRhsStartPos;
 
 		GlxInt32 Result = InIgnoreCase ?
 			CStringUtils::Strnicmp(LhsPtr, RhsPtr, GLX_MIN(InLhsLength, InRhsLength)) :
@@ -389,134 +526,143 @@ public:
 	// ==
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator==(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) == 0;
+		return CStringUtils::Strcmp(GetData(), InStr) == 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator==(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) == 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) == 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator==(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) == 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) == 0;
 	}
 
 	// !=
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator!=(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) != 0;
+		return CStringUtils::Strcmp(GetData(), InStr) != 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator!=(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) != 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) != 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator!=(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) != 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) != 0;
 	}
 
 	// >
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator>(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) > 0;
+		return CStringUtils::Strcmp(GetData(), InStr) > 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator>(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) > 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) > 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator>(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) > 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) > 0;
 	}
 
 	// >=
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator>=(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) >= 0;
+		return CStringUtils::Strcmp(GetData(), InStr) >= 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator>=(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) >= 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) >= 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator>=(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) >= 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) >= 0;
 	}
 
 	// <
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator<(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) < 0;
+		return CStringUtils::Strcmp(GetData(), InStr) < 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator<(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) < 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) < 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator<(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) < 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) < 0;
 	}
 
 	// <=
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator<=(ConstPointerType InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr) <= 0;
+		return CStringUtils::Strcmp(GetData(), InStr) <= 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool operator<=(const GlxBasicString& InStr) const
 	{
-		return CStringUtils::Strcmp(Data, InStr.Data) <= 0;
+		return CStringUtils::Strcmp(GetData(), InStr.GetData()) <= 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator<=(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return CStringUtils::Strcmp(InLhs, InRhs.Data) <= 0;
+		return CStringUtils::Strcmp(InLhs, InRhs.GetData()) <= 0;
 	}
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBasicString Substring(SizeType InStartPos) const
 	{
-		GLX_ASSERT(InStartPos >= 0 && InStartPos < Length);
-		return GlxBasicString(Data + InStartPos, Length - InStartPos);
+		GLX_ASSERT(InStartPos >= 0 && InStartPos < GetElementCount());
+		return GlxBasicString(GetData() + InStartPos, GetElementCount() - InStartPos);
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBasicString Substring(SizeType InStartPos, SizeType InLength) const
 	{
-		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= Length);
-		return GlxBasicString(Data + InStartPos, InLength);
+		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= GetElementCount());
+		return GlxBasicString(GetData() + InStartPos, InLength);
 	}
 
 	void ToUpper()
 	{
-		for (SizeType i = 0; i < Length; ++i)
+		PointerType CurData = GetData();
+		const SizeType CurLength = GetElementCount();
+
+		for (SizeType i = 0; i < CurLength; ++i)
 		{
-			Data[i] = CharUtils::ToUpper(Data[i]);
+			CurData[i] = CharUtils::ToUpper(CurData[i]);
 		}
 	}
 
 	void ToLower()
 	{
-		for (SizeType i = 0; i < Length; ++i)
+		PointerType CurData = GetData();
+		const SizeType CurLength = GetElementCount();
+
+		for (SizeType i = 0; i < CurLength; ++i)
 		{
-			Data[i] = CharUtils::ToLower(Data[i]);
+			CurData[i] = CharUtils::ToLower(CurData[i]);
 		}
 	}
 
 	void Reverse()
 	{
-		if (Length > 1)
+		PointerType CurData = GetData();
+		const SizeType CurLength = GetElementCount();
+
+		if (CurLength > 1)
 		{
-			PointerType Start = Data;
-			PointerType End = Data + (Length - 1);
+			PointerType Start = CurData;
+			PointerType End = CurData + (CurLength - 1);
 			ElementType TmpChar;
 			do
 			{
@@ -531,12 +677,14 @@ public:
 
 	GLX_NODISCARD SizeType Find(SizeType InSubstrLen, ConstPointerType InSubstr, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
 	{
+		const SizeType CurLength = GetElementCount();
+
 		if (InStartPos < 0)
 		{
 			InStartPos = 0;
 		}
 
-		if (InSubstrLen > Length || InStartPos > Length - InSubstrLen)
+		if (InSubstrLen > CurLength || InStartPos > CurLength - InSubstrLen)
 		{
 			return InvalidIndex;
 		}
@@ -546,41 +694,20 @@ public:
 			return InStartPos;
 		}
 
-		ConstPointerType EndStrPos = Data + (Length - InSubstrLen) + 1;
-
-		if (InIgnoreCase)
-		{
-			const ElementType FirstUpperSubstrChar = CharUtils::ToUpper(*InSubstr);
-			for (ConstPointerType Tmp = Data + InStartPos; Tmp < EndStrPos; ++Tmp)
-			{
-				if (CharUtils::ToUpper(*Tmp) == FirstUpperSubstrChar && CStringUtils::Strnicmp(Tmp, InSubstr, InSubstrLen) == 0)
-				{
-					return static_cast<SizeType>(Tmp - Data);
-				}
-			}
-		}
-		else
-		{
-			for (ConstPointerType Tmp = Data + InStartPos; Tmp < EndStrPos; ++Tmp)
-			{
-				if (*Tmp == *InSubstr && CStringUtils::Strncmp(Tmp, InSubstr, InSubstrLen) == 0)
-				{
-					return static_cast<SizeType>(Tmp - Data);
-				}
-			}
-		}
-
-		return InvalidIndex;
+		const SizeType Pos = StringSearch::Find(GetData() + InStartPos, CurLength - InStartPos, InSubstr, InSubstrLen, InIgnoreCase);
+		return Pos != InvalidIndex ? Pos + InStartPos : InvalidIndex;
 	}
 
 	GLX_NODISCARD SizeType FindLast(SizeType InSubstrLen, ConstPointerType InSubstr, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
 	{
-		if (InStartPos == InvalidIndex || InStartPos > Length)
+		const SizeType CurLength = GetElementCount();
+
+		if (InStartPos == InvalidIndex || InStartPos > CurLength)
 		{
-			InStartPos = Length;
+			InStartPos = CurLength;
 		}
 
-		if (InSubstrLen > Length)
+		if (InSubstrLen > CurLength)
 		{
 			return InvalidIndex;
 		}
@@ -590,65 +717,24 @@ public:
 			return InStartPos;
 		}
 
-		if (InIgnoreCase)
-		{
-			SizeType Offset = Length - InSubstrLen;
-			const ElementType FirstUpperSubstrChar = CharUtils::ToUpper(*InSubstr);
-
-			for (ConstPointerType Tmp = Data + (GLX_MIN(InStartPos, Offset));; --Tmp)
-			{
-				if (CharUtils::ToUpper(*Tmp) == FirstUpperSubstrChar && CStringUtils::Strnicmp(Tmp, InSubstr, InSubstrLen) == 0)
-				{
-					return static_cast<SizeType>(Tmp - Data);
-				}
-
-				if (Tmp == Data)
-				{
-					break;
-				}
-			}
-		}
-		else
-		{
-			SizeType Offset = Length - InSubstrLen;
-
-			for (ConstPointerType Tmp = Data + (GLX_MIN(InStartPos, Offset));; --Tmp)
-			{
-				if (*Tmp == *InSubstr && CStringUtils::Strncmp(Tmp, InSubstr, InSubstrLen) == 0)
-				{
-					return static_cast<SizeType>(Tmp - Data);
-				}
-
-				if (Tmp == Data)
-				{
-					break;
-				}
-			}
-		}
-
-		return InvalidIndex;
+		// Only matches starting at or before InStartPos count, so the match must end within LastPos + InSubstrLen.
+		const SizeType LastPos = GLX_MIN(InStartPos, CurLength - InSubstrLen);
+		return StringSearch::FindLast(GetData(), LastPos + InSubstrLen, InSubstr, InSubstrLen, InIgnoreCase);
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE SizeType Find(const GlxBasicString& InSubstr, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
 	{
-		return Find(InSubstr.Length, InSubstr.Data, InStartPos, InIgnoreCase);
+		return Find(InSubstr.GetElementCount(), InSubstr.GetData(), InStartPos, InIgnoreCase);
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE SizeType FindLast(const GlxBasicString& InSubstr, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
 	{
-		return FindLast(InSubstr.Length, InSubstr.Data, InStartPos, InIgnoreCase);
+		return FindLast(InSubstr.GetElementCount(), InSubstr.GetData(), InStartPos, InIgnoreCase);
 	}
 
 	GLX_NODISCARD SizeType Find(ConstPointerType InSubstr, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
 	{
-		if (InStartPos < 0)
-		{
-			InStartPos = 0;
-		}
-
-		ConstPointerType Pos = InIgnoreCase ? CStringUtils::Stristr(Data + InStartPos, InSubstr) : CStringUtils::Strstr(Data + InStartPos, InSubstr);
-
-		return Pos ? static_cast<SizeType>(Pos - Data) : InvalidIndex;
+		return Find(static_cast<SizeType>(CStringUtils::Strlen(InSubstr)), InSubstr, InStartPos, InIgnoreCase);
 	}
 
 	GLX_NODISCARD SizeType FindLast(ConstPointerType InSubstr, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
@@ -658,150 +744,83 @@ public:
 
 	GLX_NODISCARD SizeType FindChar(ElementType InCh, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
 	{
+		const SizeType CurLength = GetElementCount();
+
 		if (InStartPos < 0)
 		{
 			InStartPos = 0;
 		}
 
-		if (InIgnoreCase)
-		{
-			ConstPointerType Start = Data + InStartPos;
-			ElementType UpperChr = CharUtils::ToUpper(InCh);
-
-			while (*Start)
-			{
-				if (CharUtils::ToUpper(*Start) == UpperChr)
-				{
-					return static_cast<SizeType>(Start - Data);
-				}
-				++Start;
-			}
-		}
-		else
+		if (InStartPos >= CurLength)
 		{
-			ConstPointerType Pos = CStringUtils::Strchr(Data + InStartPos, InCh);
-			return Pos ? static_cast<SizeType>(Pos - Data) : InvalidIndex;
+			return InvalidIndex;
 		}
 
-		return InvalidIndex;
+		const SizeType Pos = StringSearch::FindChar(GetData() + InStartPos, CurLength - InStartPos, InCh, InIgnoreCase);
+		return Pos != InvalidIndex ? Pos + InStartPos : InvalidIndex;
 	}
 
 	GLX_NODISCARD SizeType FindLastChar(ElementType InCh, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
 	{
-		ConstPointerType End = Data + ((InStartPos < 0) ? Length : InStartPos);
-
-		if (InIgnoreCase)
-		{
-			ElementType UpperChr = CharUtils::ToUpper(InCh);
-			for (;; --End)
-			{
-				if (CharUtils::ToUpper(*End) == UpperChr)
-				{
-					return static_cast<SizeType>(End - Data);
-				}
-
-				if (End == Data)
-				{
-					break;
-				}
-			}
-		}
-		else
-		{
-			for (;; --End)
-			{
-				if (*End == InCh)
-				{
-					return static_cast<SizeType>(End - Data);
-				}
-
-				if (End == Data)
-				{
-					break;
-				}
-			}
-		}
+		const SizeType CurLength = GetElementCount();
+		const SizeType Count = (InStartPos < 0 || InStartPos >= CurLength) ? CurLength : InStartPos + 1;
 
-		return InvalidIndex;
+		return StringSearch::FindLastChar(GetData(), Count, InCh, InIgnoreCase);
 	}
 
 	GLX_NODISCARD GlxBool Contains(ConstPointerType InSubstr, GlxBool InIgnoreCase = false) const
 	{
-		if (InIgnoreCase)
-		{
-			return CStringUtils::Stristr(Data, InSubstr) != nullptr;
-		}
-		return CStringUtils::Strstr(Data, InSubstr) != nullptr;
+		return Find(static_cast<SizeType>(CStringUtils::Strlen(InSubstr)), InSubstr, 0, InIgnoreCase) != InvalidIndex;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool Contains(const GlxBasicString& InSubstr, GlxBool InIgnoreCase = false) const
 	{
-		return Contains(InSubstr.Data, InIgnoreCase);
+		return Contains(InSubstr.GetData(), InIgnoreCase);
 	}
 
 	GLX_FORCE_INLINE void Clear()
 	{
-		Length = 0;
-		*Data = NullChar;
+		SetLength(0);
 	}
 
 	void Resize(SizeType InNewLength, ElementType InCh = NullChar)
 	{
 		GLX_ASSERT(InNewLength >= 0);
 
-		if (InNewLength == Length)
+		const SizeType CurLength = GetElementCount();
+
+		if (InNewLength == CurLength)
 		{
 			return;
 		}
 
-		if (InNewLength > Capacity)
+		if (InNewLength > GetCapacity())
 		{
-			Capacity = InNewLength;
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, Length * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
+			Reallocate(InNewLength);
 		}
 
-		if (InNewLength > Length)
+		if (InNewLength > CurLength)
 		{
-			if constexpr (IsChar)
-			{
-				GLX_MEMSET(Data + Length, InCh, InNewLength - Length);
-			}
-			else if constexpr (IsWChar)
-			{
-				GLX_WMEMSET(Data + Length, InCh, InNewLength - Length);
-			}
+			Fill(GetData() + CurLength, InCh, InNewLength - CurLength);
 		}
 
-		Data[InNewLength] = NullChar;
-		Length = InNewLength;
+		SetLength(InNewLength);
 	}
 
 	void Reserve(SizeType NewCapacity)
 	{
-		if (NewCapacity > Capacity)
+		if (NewCapacity > GetCapacity())
 		{
-			Capacity = NewCapacity;
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, Length * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
-			Data[Length] = NullChar;
+			Reallocate(NewCapacity);
 		}
 	}
 
+	// Heap strings short enough to fit inline move back into the object.
 	void Shrink()
 	{
-		if (Capacity != Length)
+		if (!IsInline() && (Heap.Length <= InlineCapacity || Heap.Capacity != Heap.Length))
 		{
-			Capacity = Length;
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, Length * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
-			Data[Length] = NullChar;
+			Reallocate(Heap.Length);
 		}
 	}
 
@@ -809,9 +828,9 @@ public:
 	{
 		if (InIgnoreCase)
 		{
-			return InPrefixLen >= 0 && Length >= InPrefixLen && CStringUtils::Strnicmp(Data, InPrefix, InPrefixLen) == 0;
+			return InPrefixLen >= 0 && GetElementCount() >= InPrefixLen && CStringUtils::Strnicmp(GetData(), InPrefix, InPrefixLen) == 0;
 		}
-		return InPrefixLen >= 0 && Length >= InPrefixLen && CStringUtils::Strncmp(Data, InPrefix, InPrefixLen) == 0;
+		return InPrefixLen >= 0 && GetElementCount() >= InPrefixLen && CStringUtils::Strncmp(GetData(), InPrefix, InPrefixLen) == 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool StartsWith(ConstPointerType InPrefix, GlxBool InIgnoreCase = false) const
@@ -821,7 +840,7 @@ public:
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool StartsWith(const GlxBasicString& InPrefix, GlxBool InIgnoreCase = false) const
 	{
-		return StartsWith(InPrefix.Data, InPrefix.Length, InIgnoreCase);
+		return StartsWith(InPrefix.GetData(), InPrefix.GetElementCount(), InIgnoreCase);
 	}
 
 	//////////////////////////////////////////////////////////////////////////////////////
@@ -829,9 +848,9 @@ public:
 	{
 		if (InIgnoreCase)
 		{
-			return InSuffixLen >= 0 && Length >= InSuffixLen && CStringUtils::Strnicmp(Data + (Length - InSuffixLen), InSuffix, InSuffixLen) == 0;
+			return InSuffixLen >= 0 && GetElementCount() >= InSuffixLen && CStringUtils::Strnicmp(GetData() + (GetElementCount() - InSuffixLen), InSuffix, InSuffixLen) == 0;
 		}
-		return InSuffixLen >= 0 && Length >= InSuffixLen && CStringUtils::Strncmp(Data + (Length - InSuffixLen), InSuffix, InSuffixLen) == 0;
+		return InSuffixLen >= 0 && GetElementCount() >= InSuffixLen && CStringUtils::Strncmp(GetData() + (GetElementCount() - InSuffixLen), InSuffix, InSuffixLen) == 0;
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool EndsWith(ConstPointerType InSuffix, GlxBool InIgnoreCase = false) const
@@ -841,7 +860,7 @@ public:
 
 	GLX_NODISCARD GLX_FORCE_INLINE GlxBool EndsWith(const GlxBasicString& InSuffix, GlxBool InIgnoreCase = false) const
 	{
-		return EndsWith(InSuffix.Data, InSuffix.Length, InIgnoreCase);
+		return EndsWith(InSuffix.GetData(), InSuffix.GetElementCount(), InIgnoreCase);
 	}
 
 private:
@@ -850,65 +869,53 @@ private:
 		GLX_ASSERT(InLhsLen >= 0 && InRhsLen >= 0);
 
 		GlxBasicString Str(InLhsLen + InRhsLen);
-		GLX_MEMCPY(Str.Data, InLhs, InLhsLen * sizeof(ElementType));
-		GLX_MEMCPY(Str.Data + InLhsLen, InRhs, InRhsLen * sizeof(ElementType));
+		PointerType Dest = Str.GetData();
+		GLX_MEMCPY(Dest, InLhs, InLhsLen * sizeof(ElementType));
+		GLX_MEMCPY(Dest + InLhsLen, InRhs, InRhsLen * sizeof(ElementType));
 		return Str;
 	}
 
 	GLX_NODISCARD static GlxBasicString Concat(GlxBasicString&& InLhs, GlxBasicString&& InRhs)
 	{
-		GlxBasicString Str(InLhs.Length + InRhs.Length);
-
-		GLX_MEMCPY(Str.Data, InLhs.Data, InLhs.Length * sizeof(ElementType));
-		GLX_MEMCPY(Str.Data + InLhs.Length, InRhs.Data, InRhs.Length * sizeof(ElementType));
-		InLhs.Length = 0;
-		*InLhs.Data = NullChar;
-		InRhs.Length = 0;
-		*InRhs.Data = NullChar;
+		GlxBasicString Str = Concat(InLhs.GetData(), InLhs.GetElementCount(), InRhs.GetData(), InRhs.GetElementCount());
+		InLhs.Clear();
+		InRhs.Clear();
 		return Str;
 	}
 
 	GLX_NODISCARD static GlxBasicString Concat(GlxBasicString&& InLhs, ConstPointerType InRhs, SizeType InRhsLen)
 	{
-		GlxBasicString Str(InLhs.Length + InRhsLen);
-
-		GLX_MEMCPY(Str.Data, InLhs.Data, InLhs.Length * sizeof(ElementType));
-		GLX_MEMCPY(Str.Data + InLhs.Length, InRhs, InRhsLen * sizeof(ElementType));
-		InLhs.Length = 0;
-		*InLhs.Data = NullChar;
+		GlxBasicString Str = Concat(InLhs.GetData(), InLhs.GetElementCount(), InRhs, InRhsLen);
+		InLhs.Clear();
 		return Str;
 	}
 
 	GLX_NODISCARD static GlxBasicString Concat(ConstPointerType InLhs, SizeType InLhsLen, GlxBasicString&& InRhs)
 	{
-		GlxBasicString Str(InLhsLen + InRhs.Length);
-
-		GLX_MEMCPY(Str.Data, InLhs, InLhsLen * sizeof(ElementType));
-		GLX_MEMCPY(Str.Data + InLhsLen, InRhs.Data, InRhs.Length * sizeof(ElementType));
-		InRhs.Length = 0;
-		*InRhs.Data = NullChar;
+		GlxBasicString Str = Concat(InLhs, InLhsLen, InRhs.GetData(), InRhs.GetElementCount());
+		InRhs.Clear();
 		return Str;
 	}
 
 public:
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(const GlxBasicString& InLhs, const GlxBasicString& InRhs)
 	{
-		return Concat(InLhs.Data, InLhs.Length, InRhs.Data, InRhs.Length);
+		return Concat(InLhs.GetData(), InLhs.GetElementCount(), InRhs.GetData(), InRhs.GetElementCount());
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(const GlxBasicString& InLhs, ConstPointerType InRhs)
 	{
-		return Concat(InLhs.Data, InLhs.Length, InRhs, CStringUtils::Strlen(InRhs));
+		return Concat(InLhs.GetData(), InLhs.GetElementCount(), InRhs, CStringUtils::Strlen(InRhs));
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(const GlxBasicString& InLhs, GlxBasicString&& InRhs)
 	{
-		return Concat(InLhs.Data, InLhs.Length, Move(InRhs));
+		return Concat(InLhs.GetData(), InLhs.GetElementCount(), Move(InRhs));
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(ConstPointerType InLhs, const GlxBasicString& InRhs)
 	{
-		return Concat(InLhs, CStringUtils::Strlen(InLhs), InRhs.Data, InRhs.Length);
+		return Concat(InLhs, CStringUtils::Strlen(InLhs), InRhs.GetData(), InRhs.GetElementCount());
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(ConstPointerType InLhs, GlxBasicString&& InRhs)
@@ -918,7 +925,7 @@ public:
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(GlxBasicString&& InLhs, const GlxBasicString& InRhs)
 	{
-		return Concat(Move(InLhs), InRhs.Data, InRhs.Length);
+		return Concat(Move(InLhs), InRhs.GetData(), InRhs.GetElementCount());
 	}
 
 	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBasicString operator+(GlxBasicString&& InLhs, GlxBasicString&& InRhs)
@@ -935,63 +942,35 @@ public:
 	{
 		GLX_ASSERT(InStr != nullptr && InLength >= 0);
 
-		if (Length + InLength > Capacity)
-		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InLength);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, Length * sizeof(ElementType));
-			GLX_MEMCPY(NewData + Length, InStr, InLength * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
-		}
-		else
+		const SizeType CurLength = GetElementCount();
+
+		if (CurLength + InLength > GetCapacity())
 		{
-			GLX_MEMCPY(Data + Length, InStr, InLength * sizeof(ElementType));
+			InStr = Grow(InLength, InStr);
 		}
 
-		Length += InLength;
-		Data[Length] = NullChar;
+		GLX_MEMCPY(GetData() + CurLength, InStr, InLength * sizeof(ElementType));
+		SetLength(CurLength + InLength);
 	}
 
 	void Append(ElementType InCh, SizeType InCount)
 	{
 		GLX_ASSERT(InCount >= 0);
 
-		if (Length + InCount > Capacity)
-		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, Length * sizeof(ElementType));
-			if constexpr (IsChar)
-			{
-				GLX_MEMSET(NewData + Length, InCh, InCount);
-			}
-			else if constexpr (IsWChar)
-			{
-				GLX_WMEMSET(NewData + Length, InCh, InCount);
-			}
-			GLX_FREE(Data);
-			Data = NewData;
-		}
-		else
+		const SizeType CurLength = GetElementCount();
+
+		if (CurLength + InCount > GetCapacity())
 		{
-			if constexpr (IsChar)
-			{
-				GLX_MEMSET(Data + Length, InCh, InCount);
-			}
-			else if constexpr (IsWChar)
-			{
-				GLX_WMEMSET(Data + Length, InCh, InCount);
-			}
+			Grow(InCount);
 		}
 
-		Length += InCount;
-		Data[Length] = NullChar;
+		Fill(GetData() + CurLength, InCh, InCount);
+		SetLength(CurLength + InCount);
 	}
 
 	GLX_FORCE_INLINE void Append(const GlxBasicString& InStr)
 	{
-		Append(InStr.Data, InStr.Length);
+		Append(InStr.GetData(), InStr.GetElementCount());
 	}
 
 	GLX_FORCE_INLINE void Append(ConstPointerType InStr)
@@ -1001,13 +980,13 @@ public:
 
 	GLX_FORCE_INLINE void Append(const GlxBasicString& InStr, SizeType InStartPos, SizeType InLength)
 	{
-		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= InStr.Length);
-		Append(InStr.Data + InStartPos, InLength);
+		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= InStr.GetElementCount());
+		Append(InStr.GetData() + InStartPos, InLength);
 	}
 
 	GLX_FORCE_INLINE GlxBasicString& operator+=(const GlxBasicString& InStr)
 	{
-		Append(InStr.Data, InStr.Length);
+		Append(InStr.GetData(), InStr.GetElementCount());
 		return *this;
 	}
 
@@ -1025,74 +1004,52 @@ public:
 
 	void RemoveAt(SizeType InPos, SizeType InLength)
 	{
-		GLX_ASSERT(InPos >= 0 && InLength >= 0 && InPos + InLength <= Length);
+		const SizeType CurLength = GetElementCount();
+		GLX_ASSERT(InPos >= 0 && InLength >= 0 && InPos + InLength <= CurLength);
 
-		if (InPos == 0 && InLength == Length)
-		{
-			Length = 0, *Data = NullChar;
-			return;
-		}
-
-		Length -= InLength;
-
-		PointerType Dest = Data + InPos;
-		GLX_MEMCPY(Dest, Dest + InLength, (Length - InPos) * sizeof(ElementType));
-		Data[Length] = NullChar;
+		PointerType Dest = GetData() + InPos;
+		GLX_MEMMOVE(Dest, Dest + InLength, (CurLength - InLength - InPos) * sizeof(ElementType));
+		SetLength(CurLength - InLength);
 	}
 
 	void Insert(SizeType InIndex, ConstPointerType InStr, SizeType InLength)
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex <= Length && InLength >= 0 && InStr != nullptr);
+		const SizeType CurLength = GetElementCount();
+		GLX_ASSERT(InIndex >= 0 && InIndex <= CurLength && InLength >= 0 && InStr != nullptr);
 
-		if (Length + InLength > Capacity)
+		// A piece of this string would be shifted (or freed) while it is being copied.
+		if (InStr >= GetData() && InStr < GetData() + CurLength)
 		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InLength);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			PointerType Dest = NewData + InIndex;
-			GLX_MEMCPY(NewData, Data, InIndex * sizeof(ElementType));
-			GLX_MEMCPY(Dest, InStr, InLength * sizeof(ElementType));
-			GLX_MEMCPY(Dest + InLength, Data + InIndex, (Length - InIndex) * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
+			const GlxBasicString Piece(InStr, InLength);
+			Insert(InIndex, Piece.GetData(), InLength);
+			return;
 		}
-		else
+
+		if (CurLength + InLength > GetCapacity())
 		{
-			PointerType Dest = Data + InIndex;
-			GLX_MEMMOVE(Dest + InLength, Dest, (Length - InIndex) * sizeof(ElementType));
-			GLX_MEMCPY(Dest, InStr, InLength * sizeof(ElementType));
+			Grow(InLength);
 		}
 
-		Length += InLength;
-		Data[Length] = NullChar;
+		PointerType Dest = GetData() + InIndex;
+		GLX_MEMMOVE(Dest + InLength, Dest, (CurLength - InIndex) * sizeof(ElementType));
+		GLX_MEMCPY(Dest, InStr, InLength * sizeof(ElementType));
+		SetLength(CurLength + InLength);
 	}
 
 	void Insert(SizeType InIndex, ElementType InCh, SizeType InCount)
 	{
-		GLX_ASSERT(InIndex >= 0 && InIndex <= Length && InCount >= 0);
-
-		if (Length + InCount > Capacity)
-		{
-			Capacity = static_cast<SizeType>(Capacity * GrowthFactor + InCount);
-			PointerType NewData = static_cast<PointerType>(GLX_MALLOC((Capacity + 1) * sizeof(ElementType)));
-			GLX_MEMCPY(NewData, Data, InIndex * sizeof(ElementType));
-			GLX_MEMCPY(NewData + InIndex + InCount, Data + InIndex, (Length - InIndex) * sizeof(ElementType));
-			GLX_FREE(Data);
-			Data = NewData;
-		}
+		const SizeType CurLength = GetElementCount();
+		GLX_ASSERT(InIndex >= 0 && InIndex <= CurLength && InCount >= 0);
 
-		PointerType Dest = Data + InIndex;
-		GLX_MEMMOVE(Dest + InCount, Dest, (Length - InIndex) * sizeof(ElementType));
-		if constexpr (IsChar)
-		{
-			GLX_MEMSET(Dest, InCh, InCount);
-		}
-		else if constexpr (IsWChar)
+		if (CurLength + InCount > GetCapacity())
 		{
-			GLX_WMEMSET(Dest, InCh, InCount);
+			Grow(InCount);
 		}
 
-		Length += InCount;
-		Data[Length] = NullChar;
+		PointerType Dest = GetData() + InIndex;
+		GLX_MEMMOVE(Dest + InCount, Dest, (CurLength - InIndex) * sizeof(ElementType));
+		Fill(Dest, InCh, InCount);
+		SetLength(CurLength + InCount);
 	}
 
 	GLX_FORCE_INLINE void Insert(SizeType InIndex, ConstPointerType InStr)
@@ -1102,30 +1059,33 @@ public:
 
 	GLX_FORCE_INLINE void Insert(SizeType InIndex, const GlxBasicString& InStr)
 	{
-		Insert(InIndex, InStr.Data, InStr.Length);
+		Insert(InIndex, InStr.GetData(), InStr.GetElementCount());
 	}
 
 	GLX_FORCE_INLINE void Insert(SizeType InIndex, const GlxBasicString& InStr, SizeType InStartPos, SizeType InLength)
 	{
-		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= InStr.Length);
-		Insert(InIndex, InStr.Data + InStartPos, InLength);
+		GLX_ASSERT(InStartPos >= 0 && InStartPos + InLength <= InStr.GetElementCount());
+		Insert(InIndex, InStr.GetData() + InStartPos, InLength);
 	}
 
 	void TrimStart()
 	{
+		PointerType CurData = GetData();
+		const SizeType CurLength = GetElementCount();
+
 		SizeType Pos = 0;
-		while (Pos < Length)
+		while (Pos < CurLength)
 		{
 			if constexpr (IsChar)
 			{
-				if (!isspace(Data[Pos]))
+				if (!isspace(CurData[Pos]))
 				{
 					break;
 				}
 			}
 			else if constexpr (IsWChar)
 			{
-				if (!iswspace(Data[Pos]))
+				if (!iswspace(CurData[Pos]))
 				{
 					break;
 				}
@@ -1138,19 +1098,22 @@ public:
 
 	void TrimEnd()
 	{
-		SizeType End = Length;
+		PointerType CurData = GetData();
+		const SizeType CurLength = GetElementCount();
+
+		SizeType End = CurLength;
 		while (End > 0)
 		{
 			if constexpr (IsChar)
 			{
-				if (!isspace(Data[End - 1]))
+				if (!isspace(CurData[End - 1]))
 				{
 					break;
 				}
 			}
 			else if constexpr (IsWChar)
 			{
-				if (!iswspace(Data[End - 1]))
+				if (!iswspace(CurData[End - 1]))
 				{
 					break;
 				}
@@ -1158,7 +1121,7 @@ public:
 			--End;
 		}
 
-		RemoveAt(End, Length - End);
+		RemoveAt(End, CurLength - End);
 	}
 
 	void Trim()
@@ -1184,83 +1147,47 @@ public:
 		return GlxBasicString<ElementType>{ Buffer.data(), static_cast<SizeType>(Buffer.size()) };
 	}
 
-private:
-	static ConstPointerType FindAnyCharImpl(ConstPointerType InStr, ConstPointerType InChars)
+	// Tokens are views into this string and are invalidated by anything that modifies or destroys it.
+	GLX_NODISCARD GLX_FORCE_INLINE GlxStringTokenizer<TChar> TokenizeBySeparators(GlxBasicStringView<TChar> InSeps, SizeType InMaxTokens = 0) const
 	{
-		if (!InStr || !InChars)
-		{
-			return nullptr;
-		}
-
-		while (*InStr != NullChar)
-		{
-			if (CStringUtils::Strchr(InChars, *InStr))
-			{
-				return InStr;
-			}
+		return GlxStringTokenizer<TChar>::BySeparators(*this, InSeps, InMaxTokens);
+	}
 
-			++InStr;
-		}
-		return nullptr;
+	GLX_NODISCARD GLX_FORCE_INLINE GlxStringTokenizer<TChar> TokenizeByString(GlxBasicStringView<TChar> InSeparator, SizeType InMaxTokens = 0) const
+	{
+		return GlxStringTokenizer<TChar>::ByString(*this, InSeparator, InMaxTokens);
 	}
 
-public:
 	void SplitBySeparators(GlxDynamicArray<GlxBasicString<ElementType>>& InArr, ConstPointerType InSeps) const
 	{
-		SizeType LastOffset = 0, Offset;
-		ConstPointerType Found = FindAnyCharImpl(Data, InSeps);
-
-		while (Found)
-		{
-			Offset = static_cast<SizeType>(Found - Data);
-			SizeType Count = Offset - LastOffset;
-			if (Count > 0)
-			{
-				InArr.EmplaceBack(*this, LastOffset, Count);
-			}
-			LastOffset = Offset + 1;
-			Found = FindAnyCharImpl(Data + LastOffset, InSeps);
-		}
-
-		Offset = Length - LastOffset;
-		if (Offset > 0)
+		for (const GlxBasicStringView<TChar>& Token : TokenizeBySeparators(InSeps))
 		{
-			InArr.EmplaceBack(*this, LastOffset, Offset);
+			InArr.EmplaceBack(Token.GetData(), Token.GetElementCount());
 		}
 	}
 
 	void SplitByString(GlxDynamicArray<GlxBasicString<ElementType>>& InArr, ConstPointerType InStr) const
 	{
-		SizeType LastOffset = 0, Offset;
-
-		const SizeType StrLen = CStringUtils::Strlen(InStr);
-		ConstPointerType Found = CStringUtils::Strstr(Data, InStr);
-
-		while (Found)
-		{
-			Offset = static_cast<SizeType>(Found - Data);
-			SizeType Count = Offset - LastOffset;
-
-			if (Count > 0)
-			{
-				InArr.EmplaceBack(*this, LastOffset, Count);
-			}
-			LastOffset = Offset + StrLen;
-			Found = CStringUtils::Strstr(Data + LastOffset, InStr);
-		}
-
-		Offset = Length - LastOffset;
-		if (Offset > 0)
+		for (const GlxBasicStringView<TChar>& Token : TokenizeByString(InStr))
 		{
-			InArr.EmplaceBack(*this, LastOffset, Offset);
+			InArr.EmplaceBack(Token.GetData(), Token.GetElementCount());
 		}
 	}
 
 private:
-	PointerType Data;
-	SizeType Length;
-	SizeType Capacity;
+	union
+	{
+		GlxHeapStorage Heap;
+		ElementType Inline[InlineSlots];
+	};
 };
 
+// Moves only steal the heap block or copy the inline bytes, so arrays of strings grow with a plain realloc.
+template<typename TChar>
+class GlxIsBitwiseRelocatable<GlxBasicString<TChar>> : public GlxTrueType
+{};
+
 using GlxString = GlxBasicString<GlxChar>;
 using GlxWString = GlxBasicString<GlxWChar>;
+
+#include "StringView.h"
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "String.h"
+
+// Accumulates text in a list of chunks. Appending never moves what has already been written: when the last chunk is
+// full a new one is allocated, each at least half the size of everything so far (capped), so appends are amortized
+// O(1) and the text is copied exactly once more by ToString().
+template<typename TChar>
+class GlxBasicStringBuilder
+{
+public:
+	using SizeType = GlxInt64;
+
+	using ElementType = TChar;
+	using ConstPointerType = const TChar*;
+
+	using StringType = GlxBasicString<TChar>;
+	using ViewType = GlxBasicStringView<TChar>;
+	using CStringUtils = GlxCStringUtils<TChar>;
+
+	static GLX_CONSTEXPR SizeType MinChunkCapacity = 256;
+	static GLX_CONSTEXPR SizeType MaxChunkCapacity = 1 << 20;
+
+	GlxBasicStringBuilder() = default;
+
+	GlxBasicStringBuilder(const GlxBasicStringBuilder&) = delete;
+	GlxBasicStringBuilder& operator=(const GlxBasicStringBuilder&) = delete;
+
+	GlxBasicStringBuilder(GlxBasicStringBuilder&& InOther) noexcept
+		: Chunks(Move(InOther.Chunks)), Length(InOther.Length)
+	{
+		InOther.Length = 0;
+	}
+
+	GlxBasicStringBuilder& operator=(GlxBasicStringBuilder&& InOther) noexcept
+	{
+		if (this != &InOther)
+		{
+			Release();
+			Chunks = Move(InOther.Chunks);
+			Length = InOther.Length;
+			InOther.Length = 0;
+		}
+		return *this;
+	}
+
+	~GlxBasicStringBuilder()
+	{
+		Release();
+	}
+
+	void Append(ConstPointerType InStr, SizeType InLength)
+	{
+		GLX_ASSERT(InLength >= 0 && (InStr || InLength == 0));
+
+		while (InLength > 0)
+		{
+			GlxChunk* Chunk = GetWritableChunk(InLength);
+			const SizeType Count = GLX_MIN(InLength, Chunk->Capacity - Chunk->Count);
+
+			GLX_MEMCPY(Chunk->GetData() + Chunk->Count, InStr, Count * sizeof(ElementType));
+			Chunk->Count += Count;
+			Length += Count;
+
+			InStr += Count;
+			InLength -= Count;
+		}
+	}
+
+	GLX_FORCE_INLINE void Append(ConstPointerType InStr)
+	{
+		Append(InStr, static_cast<SizeType>(CStringUtils::Strlen(InStr)));
+	}
+
+	GLX_FORCE_INLINE void Append(ViewType InStr)
+	{
+		Append(InStr.GetData(), InStr.GetElementCount());
+	}
+
+	GLX_FORCE_INLINE void Append(const StringType& InStr)
+	{
+		Append(InStr.GetData(), InStr.GetElementCount());
+	}
+
+	GLX_FORCE_INLINE void Append(ElementType InCh)
+	{
+		GlxChunk* Chunk = GetWritableChunk(1);
+		Chunk->GetData()[Chunk->Count++] = InCh;
+		++Length;
+	}
+
+	template<typename TArg>
+	GLX_FORCE_INLINE GlxBasicStringBuilder& operator+=(TArg&& InArg)
+	{
+		Append(Forward<TArg>(InArg));
+		return *this;
+	}
+
+	GLX_FORCE_INLINE SizeType GetElementCount() const
+	{
+		return Length;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsEmpty() const
+	{
+		return Length == 0;
+	}
+
+	// Keeps the first chunk for reuse and frees the rest.
+	void Clear()
+	{
+		for (SizeType Index = 1; Index < Chunks.GetElementCount(); ++Index)
+		{
+			GLX_FREE(Chunks[Index]);
+		}
+
+		if (!Chunks.IsEmpty())
+		{
+			Chunks[0]->Count = 0;
+			Chunks.Resize(1);
+		}
+
+		Length = 0;
+	}
+
+	// Calls InFunc(const TChar*, SizeType) for every chunk in order, e.g. to stream the text to a file.
+	template<typename TFunc>
+	void ForEachChunk(TFunc&& InFunc) const
+	{
+		for (const GlxChunk* Chunk : Chunks)
+		{
+			if (Chunk->Count > 0)
+			{
+				InFunc(Chunk->GetData(), Chunk->Count);
+			}
+		}
+	}
+
+	// Joins the chunks into a string with a single allocation.
+	GLX_NODISCARD StringType ToString() const
+	{
+		StringType Result;
+		Result.Reserve(Length);
+
+		ForEachChunk([&Result](ConstPointerType InData, SizeType InCount) { Result.Append(InData, InCount); });
+		return Result;
+	}
+
+private:
+	class GlxChunk
+	{
+	public:
+		SizeType Capacity;
+		SizeType Count;
+
+		GLX_FORCE_INLINE TChar* GetData()
+		{
+			return reinterpret_cast<TChar*>(this + 1);
+		}
+
+		GLX_FORCE_INLINE const TChar* GetData() const
+		{
+			return reinterpret_cast<const TChar*>(this + 1);
+		}
+	};
+
+	GlxChunk* GetWritableChunk(SizeType InMinSpace)
+	{
+		if (!Chunks.IsEmpty())
+		{
+			GlxChunk* Last = Chunks.GetLastElement();
+			if (Last->Count < Last->Capacity)
+			{
+				return Last;
+			}
+		}
+
+		SizeType Capacity = Length / 2;
+		Capacity = Capacity < MinChunkCapacity ? MinChunkCapacity : (Capacity > MaxChunkCapacity ? MaxChunkCapacity : Capacity);
+
+		if (Capacity < InMinSpace)
+		{
+			Capacity = InMinSpace;
+		}
+
+		GlxChunk* Chunk = static_cast<GlxChunk*>(GLX_MALLOC(sizeof(GlxChunk) + Capacity * sizeof(ElementType)));
+		Chunk->Capacity = Capacity;
+		Chunk->Count = 0;
+
+		Chunks.EmplaceBack(Chunk);
+		return Chunk;
+	}
+
+	void Release()
+	{
+		for (GlxChunk* Chunk : Chunks)
+		{
+			GLX_FREE(Chunk);
+		}
+
+		Chunks.Clear();
+		Length = 0;
+	}
+
+	GlxDynamicArray<GlxChunk*> Chunks;
+	SizeType Length = 0;
+};
+
+using GlxStringBuilder = GlxBasicStringBuilder<GlxChar>;
+using GlxWStringBuilder = GlxBasicStringBuilder<GlxWChar>;
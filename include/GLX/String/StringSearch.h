@@ -0,0 +1,471 @@
+#pragma once
+
+#include "CharUtils.h"
+#include "GLX/Assert.h"
+#include "GLX/Memory/MemoryUtils.h"
+#include "GLX/Utils/BitUtils.h"
+
+#include <cstring>
+#include <wchar.h>
+
+#if defined(GLX_SIMD_SSE2)
+	#include <emmintrin.h>
+
+	// MSVC can emit AVX2 in any function, so its kernels are always built and picked at runtime. Other compilers only
+	// build them when the whole target already has AVX2.
+	#if defined(GLX_COMPILER_MSVC) || defined(__AVX2__)
+		#define GLX_SIMD_AVX2_STRING_SEARCH
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace GlxNsPrivate
+{
+	// Case folding used by the search kernels. Narrow strings fold ASCII letters only, which is what ToUpper does in the
+	// default "C" locale and what the SIMD kernels can do without a lookup.
+	template<typename TChar>
+	GLX_FORCE_INLINE TChar GlxFoldCase(TChar InCh)
+	{
+		if constexpr (GlxIsSame<TChar, GlxChar>::Value)
+		{
+			return (InCh >= 'a' && InCh <= 'z') ? static_cast<TChar>(InCh - ('a' - 'A')) : InCh;
+		}
+		else
+		{
+			return GlxCharUtils<TChar>::ToUpper(InCh);
+		}
+	}
+
+	template<typename TChar>
+	class GlxScalarStringSearch
+	{
+	public:
+		using SizeType = GlxInt64;
+
+		static GlxBool Equals(const TChar* InLhs, const TChar* InRhs, SizeType InCount, GlxBool InIgnoreCase)
+		{
+			if (!InIgnoreCase)
+			{
+				return InCount == 0 || GLX_MEMCMP(InLhs, InRhs, static_cast<GlxSizeT>(InCount) * sizeof(TChar)) == 0;
+			}
+
+			for (SizeType Index = 0; Index < InCount; ++Index)
+			{
+				if (GlxFoldCase(InLhs[Index]) != GlxFoldCase(InRhs[Index]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		static SizeType FindChar(const TChar* InStr, SizeType InLength, TChar InCh, GlxBool InIgnoreCase)
+		{
+			const TChar Target = InIgnoreCase ? GlxFoldCase(InCh) : InCh;
+
+			for (SizeType Pos = 0; Pos < InLength; ++Pos)
+			{
+				if ((InIgnoreCase ? GlxFoldCase(InStr[Pos]) : InStr[Pos]) == Target)
+				{
+					return Pos;
+				}
+			}
+
+			return GLX_INVALID_INDEX;
+		}
+
+		static SizeType FindLastChar(const TChar* InStr, SizeType InLength, TChar InCh, GlxBool InIgnoreCase)
+		{
+			const TChar Target = InIgnoreCase ? GlxFoldCase(InCh) : InCh;
+
+			for (SizeType Pos = InLength - 1; Pos >= 0; --Pos)
+			{
+				if ((InIgnoreCase ? GlxFoldCase(InStr[Pos]) : InStr[Pos]) == Target)
+				{
+					return Pos;
+				}
+			}
+
+			return GLX_INVALID_INDEX;
+		}
+
+		static SizeType Find(const TChar* InStr, SizeType InLength, const TChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase)
+		{
+			const TChar First = InIgnoreCase ? GlxFoldCase(*InSubstr) : *InSubstr;
+
+			for (SizeType Pos = 0; Pos <= InLength - InSubstrLength; ++Pos)
+			{
+				if ((InIgnoreCase ? GlxFoldCase(InStr[Pos]) : InStr[Pos]) == First && Equals(InStr + Pos + 1, InSubstr + 1, InSubstrLength - 1, InIgnoreCase))
+				{
+					return Pos;
+				}
+			}
+
+			return GLX_INVALID_INDEX;
+		}
+
+		static SizeType FindLast(const TChar* InStr, SizeType InLength, const TChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase)
+		{
+			const TChar First = InIgnoreCase ? GlxFoldCase(*InSubstr) : *InSubstr;
+
+			for (SizeType Pos = InLength - InSubstrLength; Pos >= 0; --Pos)
+			{
+				if ((InIgnoreCase ? GlxFoldCase(InStr[Pos]) : InStr[Pos]) == First && Equals(InStr + Pos + 1, InSubstr + 1, InSubstrLength - 1, InIgnoreCase))
+				{
+					return Pos;
+				}
+			}
+
+			return GLX_INVALID_INDEX;
+		}
+	};
+
+#if defined(GLX_SIMD_SSE2)
+	class GlxSse2StringOps
+	{
+	public:
+		using VectorType = __m128i;
+
+		static GLX_CONSTEXPR GlxInt64 Width = 16;
+		static GLX_CONSTEXPR GlxUInt32 FullMask = 0xFFFFu;
+
+		static GLX_FORCE_INLINE VectorType Load(const GlxChar* InPtr)
+		{
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(InPtr));
+		}
+
+		static GLX_FORCE_INLINE VectorType Splat(GlxChar InCh)
+		{
+			return _mm_set1_epi8(InCh);
+		}
+
+		static GLX_FORCE_INLINE GlxUInt32 MatchMask(VectorType InLhs, VectorType InRhs)
+		{
+			return static_cast<GlxUInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(InLhs, InRhs)));
+		}
+
+		// Clears bit 5 of every 'a'-'z' byte. Bytes >= 0x80 compare as negative and are left alone.
+		static GLX_FORCE_INLINE VectorType FoldCase(VectorType InVec)
+		{
+			const VectorType IsLower = _mm_and_si128(_mm_cmpgt_epi8(InVec, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(InVec, _mm_set1_epi8('z' + 1)));
+			return _mm_andnot_si128(_mm_and_si128(IsLower, _mm_set1_epi8(0x20)), InVec);
+		}
+	};
+#endif
+
+#if defined(GLX_SIMD_AVX2_STRING_SEARCH)
+	class GlxAvx2StringOps
+	{
+	public:
+		using VectorType = __m256i;
+
+		static GLX_CONSTEXPR GlxInt64 Width = 32;
+		static GLX_CONSTEXPR GlxUInt32 FullMask = 0xFFFFFFFFu;
+
+		static GLX_FORCE_INLINE VectorType Load(const GlxChar* InPtr)
+		{
+			return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(InPtr));
+		}
+
+		static GLX_FORCE_INLINE VectorType Splat(GlxChar InCh)
+		{
+			return _mm256_set1_epi8(InCh);
+		}
+
+		static GLX_FORCE_INLINE GlxUInt32 MatchMask(VectorType InLhs, VectorType InRhs)
+		{
+			return static_cast<GlxUInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(InLhs, InRhs)));
+		}
+
+		static GLX_FORCE_INLINE VectorType FoldCase(VectorType InVec)
+		{
+			const VectorType IsLower = _mm256_and_si256(_mm256_cmpgt_epi8(InVec, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), InVec));
+			return _mm256_andnot_si256(_mm256_and_si256(IsLower, _mm256_set1_epi8(0x20)), InVec);
+		}
+	};
+
+	inline GlxBool GlxHasAvx2()
+	{
+	#if defined(__AVX2__)
+		return true;
+	#else
+		static const GlxBool Supported = []()
+		{
+			GlxInt32 Info[4];
+			__cpuid(Info, 0);
+
+			if (Info[0] < 7)
+			{
+				return false;
+			}
+
+			// The OS must also save the YMM registers (OSXSAVE + AVX, XCR0 bits 1 and 2).
+			__cpuid(Info, 1);
+			if ((Info[2] & (1 << 27)) == 0 || (Info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+			{
+				return false;
+			}
+
+			__cpuidex(Info, 7, 0);
+			return (Info[1] & (1 << 5)) != 0;
+		}();
+
+		return Supported;
+	#endif
+	}
+#endif
+
+#if defined(GLX_SIMD_SSE2)
+	// Narrow-string kernels. Substring search compares the first and last character of the needle against a whole
+	// vector of candidate positions at once and only verifies the positions where both match.
+	template<typename TOps>
+	class GlxSimdStringSearch
+	{
+	public:
+		using SizeType = GlxInt64;
+		using VectorType = typename TOps::VectorType;
+		using ScalarType = GlxScalarStringSearch<GlxChar>;
+
+		static GLX_CONSTEXPR SizeType Width = TOps::Width;
+
+		static GlxBool Equals(const GlxChar* InLhs, const GlxChar* InRhs, SizeType InCount, GlxBool InIgnoreCase)
+		{
+			if (!InIgnoreCase)
+			{
+				return ScalarType::Equals(InLhs, InRhs, InCount, false);
+			}
+
+			SizeType Pos = 0;
+			for (; Pos + Width <= InCount; Pos += Width)
+			{
+				if (TOps::MatchMask(TOps::FoldCase(TOps::Load(InLhs + Pos)), TOps::FoldCase(TOps::Load(InRhs + Pos))) != TOps::FullMask)
+				{
+					return false;
+				}
+			}
+
+			return ScalarType::Equals(InLhs + Pos, InRhs + Pos, InCount - Pos, true);
+		}
+
+		static SizeType FindChar(const GlxChar* InStr, SizeType InLength, GlxChar InCh, GlxBool InIgnoreCase)
+		{
+			const VectorType Target = TOps::Splat(InIgnoreCase ? GlxFoldCase(InCh) : InCh);
+
+			SizeType Pos = 0;
+			for (; Pos + Width <= InLength; Pos += Width)
+			{
+				const GlxUInt32 Mask = TOps::MatchMask(Target, Load(InStr + Pos, InIgnoreCase));
+				if (Mask)
+				{
+					return Pos + GlxBitUtils::CountTrailingZeros(Mask);
+				}
+			}
+
+			return Offset(ScalarType::FindChar(InStr + Pos, InLength - Pos, InCh, InIgnoreCase), Pos);
+		}
+
+		static SizeType FindLastChar(const GlxChar* InStr, SizeType InLength, GlxChar InCh, GlxBool InIgnoreCase)
+		{
+			const VectorType Target = TOps::Splat(InIgnoreCase ? GlxFoldCase(InCh) : InCh);
+
+			SizeType Pos = InLength;
+			while (Pos >= Width)
+			{
+				Pos -= Width;
+
+				const GlxUInt32 Mask = TOps::MatchMask(Target, Load(InStr + Pos, InIgnoreCase));
+				if (Mask)
+				{
+					return Pos + HighestBit(Mask);
+				}
+			}
+
+			return ScalarType::FindLastChar(InStr, Pos, InCh, InIgnoreCase);
+		}
+
+		static SizeType Find(const GlxChar* InStr, SizeType InLength, const GlxChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase)
+		{
+			if (InSubstrLength == 1)
+			{
+				return FindChar(InStr, InLength, *InSubstr, InIgnoreCase);
+			}
+
+			const SizeType LastOffset = InSubstrLength - 1;
+			const VectorType First = TOps::Splat(InIgnoreCase ? GlxFoldCase(InSubstr[0]) : InSubstr[0]);
+			const VectorType Last = TOps::Splat(InIgnoreCase ? GlxFoldCase(InSubstr[LastOffset]) : InSubstr[LastOffset]);
+
+			SizeType Pos = 0;
+			for (; Pos + LastOffset + Width <= InLength; Pos += Width)
+			{
+				GlxUInt32 Mask = TOps::MatchMask(First, Load(InStr + Pos, InIgnoreCase)) & TOps::MatchMask(Last, Load(InStr + Pos + LastOffset, InIgnoreCase));
+
+				while (Mask)
+				{
+					const SizeType Candidate = Pos + GlxBitUtils::CountTrailingZeros(Mask);
+					if (Equals(InStr + Candidate + 1, InSubstr + 1, InSubstrLength - 2, InIgnoreCase))
+					{
+						return Candidate;
+					}
+					Mask &= Mask - 1;
+				}
+			}
+
+			return Offset(ScalarType::Find(InStr + Pos, InLength - Pos, InSubstr, InSubstrLength, InIgnoreCase), Pos);
+		}
+
+		static SizeType FindLast(const GlxChar* InStr, SizeType InLength, const GlxChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase)
+		{
+			if (InSubstrLength == 1)
+			{
+				return FindLastChar(InStr, InLength, *InSubstr, InIgnoreCase);
+			}
+
+			const SizeType LastOffset = InSubstrLength - 1;
+			const VectorType First = TOps::Splat(InIgnoreCase ? GlxFoldCase(InSubstr[0]) : InSubstr[0]);
+			const VectorType Last = TOps::Splat(InIgnoreCase ? GlxFoldCase(InSubstr[LastOffset]) : InSubstr[LastOffset]);
+
+			// Pos is the number of candidate start positions not yet examined.
+			SizeType Pos = InLength - LastOffset;
+			while (Pos >= Width)
+			{
+				Pos -= Width;
+
+				GlxUInt32 Mask = TOps::MatchMask(First, Load(InStr + Pos, InIgnoreCase)) & TOps::MatchMask(Last, Load(InStr + Pos + LastOffset, InIgnoreCase));
+
+				while (Mask)
+				{
+					const GlxUInt32 Bit = HighestBit(Mask);
+					if (Equals(InStr + Pos + Bit + 1, InSubstr + 1, InSubstrLength - 2, InIgnoreCase))
+					{
+						return Pos + Bit;
+					}
+					Mask &= ~(1u << Bit);
+				}
+			}
+
+			return ScalarType::FindLast(InStr, Pos + LastOffset, InSubstr, InSubstrLength, InIgnoreCase);
+		}
+
+	private:
+		static GLX_FORCE_INLINE VectorType Load(const GlxChar* InPtr, GlxBool InIgnoreCase)
+		{
+			const VectorType Vec = TOps::Load(InPtr);
+			return InIgnoreCase ? TOps::FoldCase(Vec) : Vec;
+		}
+
+		static GLX_FORCE_INLINE GlxUInt32 HighestBit(GlxUInt32 InMask)
+		{
+			return 31 - GlxBitUtils::CountLeadingZeros(InMask);
+		}
+
+		static GLX_FORCE_INLINE SizeType Offset(SizeType InIndex, SizeType InBase)
+		{
+			return InIndex != GLX_INVALID_INDEX ? InIndex + InBase : GLX_INVALID_INDEX;
+		}
+	};
+#endif
+}
+
+// Length-based character and substring search. Narrow strings use SSE2 kernels (AVX2 when the CPU has it), wide strings
+// use the scalar kernels. Case-insensitive matching goes through GlxNsPrivate::GlxFoldCase.
+template<typename TChar>
+class GlxStringSearch
+{
+public:
+	using SizeType = GlxInt64;
+
+	static GlxBool EqualsIgnoreCase(const TChar* InLhs, const TChar* InRhs, SizeType InCount)
+	{
+		return Dispatch([&](auto InKernels) { return decltype(InKernels)::Equals(InLhs, InRhs, InCount, true); });
+	}
+
+	static SizeType FindChar(const TChar* InStr, SizeType InLength, TChar InCh, GlxBool InIgnoreCase = false)
+	{
+		GLX_ASSERT(InLength >= 0);
+
+		if (!InIgnoreCase)
+		{
+			const TChar* Pos = nullptr;
+
+			if constexpr (GlxIsSame<TChar, GlxChar>::Value)
+			{
+				Pos = static_cast<const TChar*>(GLX_MEMCHR(InStr, InCh, static_cast<GlxSizeT>(InLength)));
+			}
+			else
+			{
+				Pos = wmemchr(InStr, InCh, static_cast<GlxSizeT>(InLength));
+			}
+
+			return Pos ? static_cast<SizeType>(Pos - InStr) : GLX_INVALID_INDEX;
+		}
+
+		return Dispatch([&](auto InKernels) { return decltype(InKernels)::FindChar(InStr, InLength, InCh, true); });
+	}
+
+	static SizeType FindLastChar(const TChar* InStr, SizeType InLength, TChar InCh, GlxBool InIgnoreCase = false)
+	{
+		GLX_ASSERT(InLength >= 0);
+		return Dispatch([&](auto InKernels) { return decltype(InKernels)::FindLastChar(InStr, InLength, InCh, InIgnoreCase); });
+	}
+
+	// Returns 0 for an empty needle.
+	static SizeType Find(const TChar* InStr, SizeType InLength, const TChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase = false)
+	{
+		GLX_ASSERT(InLength >= 0 && InSubstrLength >= 0);
+
+		if (InSubstrLength > InLength)
+		{
+			return GLX_INVALID_INDEX;
+		}
+
+		if (InSubstrLength == 0)
+		{
+			return 0;
+		}
+
+		return Dispatch([&](auto InKernels) { return decltype(InKernels)::Find(InStr, InLength, InSubstr, InSubstrLength, InIgnoreCase); });
+	}
+
+	// Returns InLength for an empty needle.
+	static SizeType FindLast(const TChar* InStr, SizeType InLength, const TChar* InSubstr, SizeType InSubstrLength, GlxBool InIgnoreCase = false)
+	{
+		GLX_ASSERT(InLength >= 0 && InSubstrLength >= 0);
+
+		if (InSubstrLength > InLength)
+		{
+			return GLX_INVALID_INDEX;
+		}
+
+		if (InSubstrLength == 0)
+		{
+			return InLength;
+		}
+
+		return Dispatch([&](auto InKernels) { return decltype(InKernels)::FindLast(InStr, InLength, InSubstr, InSubstrLength, InIgnoreCase); });
+	}
+
+private:
+	template<typename TFunc>
+	static GLX_FORCE_INLINE auto Dispatch(TFunc&& InFunc)
+	{
+		if constexpr (GlxIsSame<TChar, GlxChar>::Value)
+		{
+#if defined(GLX_SIMD_AVX2_STRING_SEARCH)
+			if (GlxNsPrivate::GlxHasAvx2())
+			{
+				return InFunc(GlxNsPrivate::GlxSimdStringSearch<GlxNsPrivate::GlxAvx2StringOps>());
+			}
+#endif
+#if defined(GLX_SIMD_SSE2)
+			return InFunc(GlxNsPrivate::GlxSimdStringSearch<GlxNsPrivate::GlxSse2StringOps>());
+#else
+			return InFunc(GlxNsPrivate::GlxScalarStringSearch<TChar>());
+#endif
+		}
+		else
+		{
+			return InFunc(GlxNsPrivate::GlxScalarStringSearch<TChar>());
+		}
+	}
+};
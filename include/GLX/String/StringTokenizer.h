@@ -0,0 +1,205 @@
+#pragma once
+
+#include "StringView.h"
+
+// Single-pass range over the non-empty tokens of a view, produced on demand. Tokens are views into the original
+// characters, so nothing is allocated and the split stops as soon as the caller stops iterating.
+template<typename TChar>
+class GlxStringTokenizer
+{
+public:
+	using SizeType = GlxInt64;
+	using ViewType = GlxBasicStringView<TChar>;
+	using StringSearch = GlxStringSearch<TChar>;
+
+	static GLX_CONSTEXPR SizeType InvalidIndex = GLX_INVALID_INDEX;
+
+	class GlxIterator
+	{
+	public:
+		GLX_FORCE_INLINE GlxIterator(GlxStringTokenizer* InOwner)
+			: Owner(InOwner), Token()
+		{
+			Advance();
+		}
+
+		GlxIterator(const GlxIterator&) = default;
+		GlxIterator& operator=(const GlxIterator&) = default;
+		~GlxIterator() = default;
+
+		GLX_FORCE_INLINE const ViewType& operator*() const { return Token; }
+		GLX_FORCE_INLINE const ViewType* operator->() const { return &Token; }
+
+		GLX_FORCE_INLINE GlxIterator& operator++()
+		{
+			GLX_ASSERT(Owner);
+			Advance();
+			return *this;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator==(const GlxIterator& InRhs) const
+		{
+			return Owner == InRhs.Owner;
+		}
+
+		GLX_FORCE_INLINE GlxBool operator!=(const GlxIterator& InRhs) const
+		{
+			return Owner != InRhs.Owner;
+		}
+
+	private:
+		GLX_FORCE_INLINE void Advance()
+		{
+			if (Owner && !Owner->Next(Token))
+			{
+				Owner = nullptr;
+			}
+		}
+
+		GlxStringTokenizer* Owner;
+		ViewType Token;
+	};
+
+	// Splits at any of the characters in InSeparators. Characters below 256 are looked up in a bitmap built once here.
+	// With InMaxTokens > 0 the last token is the unsplit rest of the view.
+	GLX_NODISCARD static GlxStringTokenizer BySeparators(ViewType InStr, ViewType InSeparators, SizeType InMaxTokens = 0)
+	{
+		GlxStringTokenizer Tokenizer(InStr, InSeparators, InMaxTokens, false);
+
+		for (TChar Ch : InSeparators)
+		{
+			const GlxUInt32 Code = GetCode(Ch);
+			if (Code < 256)
+			{
+				Tokenizer.SeparatorBits[Code >> 6] |= 1ull << (Code & 63);
+			}
+		}
+
+		return Tokenizer;
+	}
+
+	// Splits at every occurrence of InSeparator, which must not be empty.
+	GLX_NODISCARD static GlxStringTokenizer ByString(ViewType InStr, ViewType InSeparator, SizeType InMaxTokens = 0)
+	{
+		GLX_ASSERT(!InSeparator.IsEmpty());
+		return GlxStringTokenizer(InStr, InSeparator, InMaxTokens, true);
+	}
+
+	GlxBool Next(ViewType& OutToken)
+	{
+		SkipSeparators();
+
+		if (Remaining.IsEmpty())
+		{
+			return false;
+		}
+
+		++TokenCount;
+
+		const SizeType Pos = (MaxTokens > 0 && TokenCount >= MaxTokens) ? InvalidIndex : FindSeparator();
+
+		if (Pos == InvalidIndex)
+		{
+			OutToken = Remaining;
+			Remaining = ViewType();
+		}
+		else
+		{
+			OutToken = Remaining.Substring(0, Pos);
+			Remaining.RemovePrefix(Pos + (ByStringSeparator ? Separator.GetElementCount() : 1));
+		}
+
+		return true;
+	}
+
+	// The part of the view not yet split.
+	GLX_FORCE_INLINE ViewType GetRemaining() const
+	{
+		return Remaining;
+	}
+
+	GLX_FORCE_INLINE GlxIterator begin() { return GlxIterator(this); }
+	GLX_FORCE_INLINE GlxIterator end() { return GlxIterator(nullptr); }
+
+private:
+	GlxStringTokenizer(ViewType InStr, ViewType InSeparator, SizeType InMaxTokens, GlxBool InByString)
+		: Remaining(InStr), Separator(InSeparator), SeparatorBits{ 0, 0, 0, 0 }, MaxTokens(InMaxTokens), TokenCount(0), ByStringSeparator(InByString)
+	{}
+
+	static GLX_FORCE_INLINE GlxUInt32 GetCode(TChar InCh)
+	{
+		if constexpr (sizeof(TChar) == 1)
+		{
+			return static_cast<GlxUInt8>(InCh);
+		}
+		else
+		{
+			return static_cast<GlxUInt32>(InCh);
+		}
+	}
+
+	GLX_FORCE_INLINE GlxBool IsSeparator(TChar InCh) const
+	{
+		const GlxUInt32 Code = GetCode(InCh);
+
+		if (Code < 256)
+		{
+			return ((SeparatorBits[Code >> 6] >> (Code & 63)) & 1) != 0;
+		}
+
+		return sizeof(TChar) > 1 && Separator.FindChar(InCh) != InvalidIndex;
+	}
+
+	void SkipSeparators()
+	{
+		if (ByStringSeparator)
+		{
+			while (Remaining.StartsWith(Separator))
+			{
+				Remaining.RemovePrefix(Separator.GetElementCount());
+			}
+			return;
+		}
+
+		SizeType Count = 0;
+		while (Count < Remaining.GetElementCount() && IsSeparator(Remaining[Count]))
+		{
+			++Count;
+		}
+		Remaining.RemovePrefix(Count);
+	}
+
+	SizeType FindSeparator() const
+	{
+		const TChar* Data = Remaining.GetData();
+		const SizeType Length = Remaining.GetElementCount();
+
+		if (ByStringSeparator)
+		{
+			return StringSearch::Find(Data, Length, Separator.GetData(), Separator.GetElementCount());
+		}
+
+		// A single separator is the common case (CSV, paths); let the vectorized char search find it.
+		if (Separator.GetElementCount() == 1)
+		{
+			return StringSearch::FindChar(Data, Length, Separator[0]);
+		}
+
+		for (SizeType Pos = 0; Pos < Length; ++Pos)
+		{
+			if (IsSeparator(Data[Pos]))
+			{
+				return Pos;
+			}
+		}
+
+		return InvalidIndex;
+	}
+
+	ViewType Remaining;
+	ViewType Separator;
+	GlxUInt64 SeparatorBits[4];
+	SizeType MaxTokens;
+	SizeType TokenCount;
+	GlxBool ByStringSeparator;
+};
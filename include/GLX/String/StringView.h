@@ -0,0 +1,351 @@
+#pragma once
+
+#include "CStringUtils.h"
+#include "String.h"
+#include "GLX/Containers/DynamicArray.h"
+
+template<typename TChar>
+class GlxStringTokenizer;
+
+// Non-owning, not necessarily null-terminated view of a character range. The viewed characters must outlive the view.
+template<typename TChar>
+class GlxBasicStringView
+{
+public:
+	using SizeType = GlxInt64;
+
+	using ElementType = TChar;
+	using ConstReferenceType = const TChar&;
+	using ConstPointerType = const TChar*;
+
+	using ConstIteratorType = const TChar*;
+
+	using CharUtils = GlxCharUtils<TChar>;
+	using CStringUtils = GlxCStringUtils<TChar>;
+	using StringSearch = GlxStringSearch<TChar>;
+	using StringType = GlxBasicString<TChar>;
+
+	static GLX_CONSTEXPR SizeType InvalidIndex = GLX_INVALID_INDEX;
+
+	GLX_CONSTEXPR GlxBasicStringView()
+		: Data(nullptr), Length(0)
+	{}
+
+	GlxBasicStringView(GlxNullPtr) = delete;
+
+	GlxBasicStringView(ConstPointerType InStr)
+		: Data(InStr), Length(static_cast<SizeType>(CStringUtils::Strlen(InStr)))
+	{}
+
+	GLX_CONSTEXPR GlxBasicStringView(ConstPointerType InStr, SizeType InLength)
+		: Data(InStr), Length(InLength)
+	{
+		GLX_ASSERT(InLength >= 0 && (InStr || InLength == 0));
+	}
+
+	GlxBasicStringView(const StringType& InStr)
+		: Data(InStr.GetData()), Length(InStr.GetElementCount())
+	{}
+
+	GlxBasicStringView(const GlxBasicStringView&) = default;
+	GlxBasicStringView& operator=(const GlxBasicStringView&) = default;
+
+	GLX_NODISCARD GLX_FORCE_INLINE StringType ToString() const
+	{
+		return StringType(Data, Length);
+	}
+
+	GLX_FORCE_INLINE explicit operator StringType() const
+	{
+		return ToString();
+	}
+
+	GLX_FORCE_INLINE SizeType GetElementCount() const
+	{
+		return Length;
+	}
+
+	GLX_FORCE_INLINE ConstPointerType GetData() const
+	{
+		return Data;
+	}
+
+	GLX_FORCE_INLINE GlxBool IsEmpty() const
+	{
+		return Length == 0;
+	}
+
+	GLX_FORCE_INLINE ConstReferenceType operator[](SizeType InIndex) const
+	{
+		GLX_ASSERT(InIndex >= 0 && InIndex < Length);
+		return Data[InIndex];
+	}
+
+	GLX_FORCE_INLINE ConstReferenceType GetFirstElement() const
+	{
+		GLX_ASSERT(Length > 0);
+		return *Data;
+	}
+
+	GLX_FORCE_INLINE ConstReferenceType GetLastElement() const
+	{
+		GLX_ASSERT(Length > 0);
+		return Data[Length - 1];
+	}
+
+	GLX_FORCE_INLINE ConstIteratorType begin() const
+	{
+		return Data;
+	}
+
+	GLX_FORCE_INLINE ConstIteratorType end() const
+	{
+		return Data + Length;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE GlxBasicStringView Substring(SizeType InStartPos) const
+	{
+		GLX_ASSERT(InStartPos >= 0 && InStartPos <= Length);
+		return GlxBasicStringView(Data + InStartPos, Length - InStartPos);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE GlxBasicStringView Substring(SizeType InStartPos, SizeType InLength) const
+	{
+		GLX_ASSERT(InStartPos >= 0 && InLength >= 0 && InStartPos + InLength <= Length);
+		return GlxBasicStringView(Data + InStartPos, InLength);
+	}
+
+	GLX_FORCE_INLINE void RemovePrefix(SizeType InCount)
+	{
+		GLX_ASSERT(InCount >= 0 && InCount <= Length);
+		Data += InCount;
+		Length -= InCount;
+	}
+
+	GLX_FORCE_INLINE void RemoveSuffix(SizeType InCount)
+	{
+		GLX_ASSERT(InCount >= 0 && InCount <= Length);
+		Length -= InCount;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	GLX_NODISCARD GlxInt32 Compare(GlxBasicStringView InOther, GlxBool InIgnoreCase = false) const
+	{
+		const SizeType MinLength = Length < InOther.Length ? Length : InOther.Length;
+
+		if (MinLength > 0)
+		{
+			const GlxInt32 Result = CompareChars(Data, InOther.Data, MinLength, InIgnoreCase);
+
+			if (Result != 0)
+			{
+				return Result;
+			}
+		}
+
+		return Length == InOther.Length ? 0 : (Length < InOther.Length ? -1 : 1);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE GlxBool Equals(GlxBasicStringView InOther, GlxBool InIgnoreCase = false) const
+	{
+		if (Length != InOther.Length)
+		{
+			return false;
+		}
+
+		return InIgnoreCase ? StringSearch::EqualsIgnoreCase(Data, InOther.Data, Length) : (Length == 0 || CompareChars(Data, InOther.Data, Length, false) == 0);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator==(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return InLhs.Equals(InRhs);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator!=(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return !InLhs.Equals(InRhs);
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator<(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return InLhs.Compare(InRhs) < 0;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator<=(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return InLhs.Compare(InRhs) <= 0;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator>(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return InLhs.Compare(InRhs) > 0;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE friend GlxBool operator>=(GlxBasicStringView InLhs, GlxBasicStringView InRhs)
+	{
+		return InLhs.Compare(InRhs) >= 0;
+	}
+
+	GLX_NODISCARD GlxBool StartsWith(GlxBasicStringView InPrefix, GlxBool InIgnoreCase = false) const
+	{
+		return Length >= InPrefix.Length && Substring(0, InPrefix.Length).Equals(InPrefix, InIgnoreCase);
+	}
+
+	GLX_NODISCARD GlxBool EndsWith(GlxBasicStringView InSuffix, GlxBool InIgnoreCase = false) const
+	{
+		return Length >= InSuffix.Length && Substring(Length - InSuffix.Length).Equals(InSuffix, InIgnoreCase);
+	}
+
+	GLX_NODISCARD SizeType Find(GlxBasicStringView InSubstr, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
+	{
+		if (InStartPos < 0)
+		{
+			InStartPos = 0;
+		}
+
+		if (InSubstr.Length > Length || InStartPos > Length - InSubstr.Length)
+		{
+			return InvalidIndex;
+		}
+
+		const SizeType Pos = StringSearch::Find(Data + InStartPos, Length - InStartPos, InSubstr.Data, InSubstr.Length, InIgnoreCase);
+		return Pos != InvalidIndex ? Pos + InStartPos : InvalidIndex;
+	}
+
+	GLX_NODISCARD SizeType FindLast(GlxBasicStringView InSubstr, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
+	{
+		if (InSubstr.Length > Length)
+		{
+			return InvalidIndex;
+		}
+
+		const SizeType LastPos = Length - InSubstr.Length;
+		const SizeType Pos = (InStartPos < 0 || InStartPos > LastPos) ? LastPos : InStartPos;
+
+		return StringSearch::FindLast(Data, Pos + InSubstr.Length, InSubstr.Data, InSubstr.Length, InIgnoreCase);
+	}
+
+	GLX_NODISCARD SizeType FindChar(ElementType InCh, SizeType InStartPos = 0, GlxBool InIgnoreCase = false) const
+	{
+		if (InStartPos < 0)
+		{
+			InStartPos = 0;
+		}
+
+		if (InStartPos >= Length)
+		{
+			return InvalidIndex;
+		}
+
+		const SizeType Pos = StringSearch::FindChar(Data + InStartPos, Length - InStartPos, InCh, InIgnoreCase);
+		return Pos != InvalidIndex ? Pos + InStartPos : InvalidIndex;
+	}
+
+	GLX_NODISCARD SizeType FindLastChar(ElementType InCh, SizeType InStartPos = InvalidIndex, GlxBool InIgnoreCase = false) const
+	{
+		const SizeType Count = (InStartPos < 0 || InStartPos >= Length) ? Length : InStartPos + 1;
+		return StringSearch::FindLastChar(Data, Count, InCh, InIgnoreCase);
+	}
+
+	// Index of the first character that is one of InChars.
+	GLX_NODISCARD SizeType FindAnyChar(GlxBasicStringView InChars, SizeType InStartPos = 0) const
+	{
+		for (SizeType Pos = InStartPos < 0 ? 0 : InStartPos; Pos < Length; ++Pos)
+		{
+			if (InChars.FindChar(Data[Pos]) != InvalidIndex)
+			{
+				return Pos;
+			}
+		}
+
+		return InvalidIndex;
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE GlxBool Contains(GlxBasicStringView InSubstr, GlxBool InIgnoreCase = false) const
+	{
+		return Find(InSubstr, 0, InIgnoreCase) != InvalidIndex;
+	}
+
+	void TrimStart()
+	{
+		while (Length > 0 && CharUtils::IsSpace(*Data))
+		{
+			++Data;
+			--Length;
+		}
+	}
+
+	void TrimEnd()
+	{
+		while (Length > 0 && CharUtils::IsSpace(Data[Length - 1]))
+		{
+			--Length;
+		}
+	}
+
+	GLX_FORCE_INLINE void Trim()
+	{
+		TrimStart();
+		TrimEnd();
+	}
+
+	// Lazily yields the non-empty pieces between any of the characters in InSeps, see GlxStringTokenizer.
+	GLX_NODISCARD GLX_FORCE_INLINE GlxStringTokenizer<TChar> TokenizeBySeparators(GlxBasicStringView InSeps, SizeType InMaxTokens = 0) const
+	{
+		return GlxStringTokenizer<TChar>::BySeparators(*this, InSeps, InMaxTokens);
+	}
+
+	// Lazily yields the non-empty pieces between occurrences of InSeparator, see GlxStringTokenizer.
+	GLX_NODISCARD GLX_FORCE_INLINE GlxStringTokenizer<TChar> TokenizeByString(GlxBasicStringView InSeparator, SizeType InMaxTokens = 0) const
+	{
+		return GlxStringTokenizer<TChar>::ByString(*this, InSeparator, InMaxTokens);
+	}
+
+	// Appends the non-empty pieces between any of the characters in InSeps.
+	void SplitBySeparators(GlxDynamicArray<GlxBasicStringView>& InArr, GlxBasicStringView InSeps) const
+	{
+		for (const GlxBasicStringView& Token : TokenizeBySeparators(InSeps))
+		{
+			InArr.EmplaceBack(Token);
+		}
+	}
+
+	// Appends the non-empty pieces between occurrences of InSeparator.
+	void SplitByString(GlxDynamicArray<GlxBasicStringView>& InArr, GlxBasicStringView InSeparator) const
+	{
+		for (const GlxBasicStringView& Token : TokenizeByString(InSeparator))
+		{
+			InArr.EmplaceBack(Token);
+		}
+	}
+
+private:
+	static GLX_FORCE_INLINE GlxInt32 CompareChars(ConstPointerType InLhs, ConstPointerType InRhs, SizeType InCount, GlxBool InIgnoreCase)
+	{
+		if (!InIgnoreCase)
+		{
+			return CStringUtils::Strncmp(InLhs, InRhs, static_cast<GlxSizeT>(InCount));
+		}
+
+		for (SizeType Idx = 0; Idx < InCount; ++Idx)
+		{
+			const ElementType Lhs = CharUtils::ToUpper(InLhs[Idx]);
+			const ElementType Rhs = CharUtils::ToUpper(InRhs[Idx]);
+
+			if (Lhs != Rhs)
+			{
+				return Lhs < Rhs ? -1 : 1;
+			}
+		}
+
+		return 0;
+	}
+
+	ConstPointerType Data;
+	SizeType Length;
+};
+
+using GlxStringView = GlxBasicStringView<GlxChar>;
+using GlxWStringView = GlxBasicStringView<GlxWChar>;
+
+#include "StringTokenizer.h"
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "GLX/Preprocessor.h"
+#include "GLX/Utils/NonCopyable.h"
+
+#if defined(GLX_PLATFORM_WINDOWS)
+///////////////////////////////////////
+#include <Windows.h>
+using GlxReadWriteLockHandle = SRWLOCK;
+///////////////////////////////////////
+#else
+	#error "GlxReadWriteLockHandle is not declared on the current platform!"
+#endif
+
+class GLX_API GlxReadWriteLock : public GlxNonCopyable
+{
+public:
+	GlxReadWriteLock() noexcept;
+	~GlxReadWriteLock();
+
+	void LockRead();
+	void UnlockRead();
+	bool TryLockRead();
+
+	void LockWrite();
+	void UnlockWrite();
+	bool TryLockWrite();
+
+	GLX_FORCE_INLINE GlxReadWriteLockHandle GetHandle() const
+	{
+		return Handle;
+	}
+
+private:
+	GlxReadWriteLockHandle Handle;
+};
+
+template<typename TLock>
+class GlxScopedReadLock : public GlxNonCopyable
+{
+public:
+	using LockType = TLock;
+
+	explicit GLX_INLINE GlxScopedReadLock(LockType& InLock)
+		: Lock(InLock)
+	{
+		Lock.LockRead();
+	}
+
+	~GlxScopedReadLock()
+	{
+		Lock.UnlockRead();
+	}
+
+private:
+	LockType& Lock;
+};
+
+template<typename TLock>
+class GlxScopedWriteLock : public GlxNonCopyable
+{
+public:
+	using LockType = TLock;
+
+	explicit GLX_INLINE GlxScopedWriteLock(LockType& InLock)
+		: Lock(InLock)
+	{
+		Lock.LockWrite();
+	}
+
+	~GlxScopedWriteLock()
+	{
+		Lock.UnlockWrite();
+	}
+
+private:
+	LockType& Lock;
+};
+
+#if defined(GLX_PLATFORM_WINDOWS)
+///////////////////////////////////////
+#include "Windows/WindowsReadWriteLockImpl.h"
+///////////////////////////////////////
+#else
+	#error "GlxReadWriteLock is not implemented on the current platform!"
+#endif
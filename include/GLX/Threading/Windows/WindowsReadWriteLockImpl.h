@@ -0,0 +1,43 @@
+#pragma once
+
+#if defined(GLX_PLATFORM_WINDOWS)
+
+GlxReadWriteLock::GlxReadWriteLock() noexcept
+{
+	InitializeSRWLock(&Handle);
+}
+
+GlxReadWriteLock::~GlxReadWriteLock()
+{}
+
+void GlxReadWriteLock::LockRead()
+{
+	AcquireSRWLockShared(&Handle);
+}
+
+void GlxReadWriteLock::UnlockRead()
+{
+	ReleaseSRWLockShared(&Handle);
+}
+
+bool GlxReadWriteLock::TryLockRead()
+{
+	return TryAcquireSRWLockShared(&Handle) != 0;
+}
+
+void GlxReadWriteLock::LockWrite()
+{
+	AcquireSRWLockExclusive(&Handle);
+}
+
+void GlxReadWriteLock::UnlockWrite()
+{
+	ReleaseSRWLockExclusive(&Handle);
+}
+
+bool GlxReadWriteLock::TryLockWrite()
+{
+	return TryAcquireSRWLockExclusive(&Handle) != 0;
+}
+
+#endif
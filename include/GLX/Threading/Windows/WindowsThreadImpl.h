@@ -4,9 +4,11 @@
 
 #include <functional>
 
+// The bound procedure is kept in its own heap block: GlxThread::ProcType only has room for a pointer-sized callable.
+template<typename TProc>
 static DWORD WINAPI RunThread(LPVOID InData)
 {
-	GlxThread::ProcType* ProcPtr = static_cast<GlxThread::ProcType*>(InData);
+	TProc* ProcPtr = static_cast<TProc*>(InData);
 	ProcPtr->operator()();
 	delete ProcPtr;
 	ProcPtr = nullptr;
@@ -16,9 +18,10 @@ static DWORD WINAPI RunThread(LPVOID InData)
 template<typename TFunc, typename... TArgs>
 GlxThread::GlxThread(TFunc&& InF, TArgs&&... InArgs)
 {
-	GlxThread::ProcType* ProcPtr = new GlxThread::ProcType(std::bind(Forward<TFunc>(InF), Forward<TArgs>(InArgs)...));
+	using BoundProcType = decltype(std::bind(Forward<TFunc>(InF), Forward<TArgs>(InArgs)...));
+	BoundProcType* ProcPtr = new BoundProcType(std::bind(Forward<TFunc>(InF), Forward<TArgs>(InArgs)...));
 
-	Data.ThreadHandle = CreateThread(nullptr, 0, RunThread, ProcPtr, 0, &Data.ThreadID);
+	Data.ThreadHandle = CreateThread(nullptr, 0, RunThread<BoundProcType>, ProcPtr, 0, &Data.ThreadID);
 	GLX_ASSERT(Data.ThreadHandle);
 }
 
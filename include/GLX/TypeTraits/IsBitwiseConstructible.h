@@ -24,6 +24,16 @@ template<typename TLhs, typename TRhs>
 class GlxIsBitwiseConstructible<const TLhs, TRhs> : public GlxIsBitwiseConstructible<TLhs, TRhs>
 {};
 
+// Objects that can be moved to a new address with memcpy, skipping both the move constructor and the destructor of the
+// source. Specialize it for non-trivial types that hold no pointer into themselves (e.g. heap-backed containers).
+template<typename T>
+class GlxIsBitwiseRelocatable : public GlxBoolConstant<GlxIsTriviallyCopyable<T>::Value>
+{};
+
+template<typename T>
+class GlxIsBitwiseRelocatable<const T> : public GlxIsBitwiseRelocatable<T>
+{};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "GLX/Assert.h"
+#include "GLX/Preprocessor.h"
+#include "GLX/Types/DataTypes.h"
+
+#if defined(GLX_COMPILER_MSVC)
+	#include <intrin.h>
+#endif
+
+class GlxBitUtils
+{
+public:
+	static GLX_FORCE_INLINE GlxUInt32 CountTrailingZeros(GlxUInt32 InVal)
+	{
+		if (InVal == 0)
+		{
+			return 32;
+		}
+
+#if defined(GLX_COMPILER_MSVC)
+		unsigned long Index;
+		_BitScanForward(&Index, InVal);
+		return static_cast<GlxUInt32>(Index);
+#else
+		return static_cast<GlxUInt32>(__builtin_ctz(InVal));
+#endif
+	}
+
+	static GLX_FORCE_INLINE GlxUInt32 CountTrailingZeros(GlxUInt64 InVal)
+	{
+		if (InVal == 0)
+		{
+			return 64;
+		}
+
+#if defined(GLX_COMPILER_MSVC)
+		unsigned long Index;
+		_BitScanForward64(&Index, InVal);
+		return static_cast<GlxUInt32>(Index);
+#else
+		return static_cast<GlxUInt32>(__builtin_ctzll(InVal));
+#endif
+	}
+
+	static GLX_FORCE_INLINE GlxUInt32 CountLeadingZeros(GlxUInt32 InVal)
+	{
+		if (InVal == 0)
+		{
+			return 32;
+		}
+
+#if defined(GLX_COMPILER_MSVC)
+		unsigned long Index;
+		_BitScanReverse(&Index, InVal);
+		return 31 - static_cast<GlxUInt32>(Index);
+#else
+		return static_cast<GlxUInt32>(__builtin_clz(InVal));
+#endif
+	}
+
+	static GLX_FORCE_INLINE GlxUInt32 CountLeadingZeros(GlxUInt64 InVal)
+	{
+		if (InVal == 0)
+		{
+			return 64;
+		}
+
+#if defined(GLX_COMPILER_MSVC)
+		unsigned long Index;
+		_BitScanReverse64(&Index, InVal);
+		return 63 - static_cast<GlxUInt32>(Index);
+#else
+		return static_cast<GlxUInt32>(__builtin_clzll(InVal));
+#endif
+	}
+
+	static GLX_CONSTEXPR GLX_FORCE_INLINE GlxBool IsPowerOfTwo(GlxUInt64 InVal)
+	{
+		return InVal != 0 && (InVal & (InVal - 1)) == 0;
+	}
+
+	// InVal must not exceed 2^63, the largest power of two a GlxUInt64 holds.
+	static GLX_FORCE_INLINE GlxUInt64 RoundUpToPowerOfTwo(GlxUInt64 InVal)
+	{
+		GLX_ASSERT(InVal <= (1ULL << 63));
+
+		if (InVal <= 1)
+		{
+			return 1;
+		}
+
+		return 1ULL << (64 - CountLeadingZeros(InVal - 1));
+	}
+
+	static GLX_FORCE_INLINE GlxUInt32 FloorLog2(GlxUInt64 InVal)
+	{
+		return 63 - CountLeadingZeros(InVal);
+	}
+
+	static GLX_FORCE_INLINE GlxUInt64 MultiplyHigh(GlxUInt64 InA, GlxUInt64 InB)
+	{
+#if defined(GLX_COMPILER_MSVC)
+		return __umulh(InA, InB);
+#else
+		return static_cast<GlxUInt64>((static_cast<unsigned __int128>(InA) * InB) >> 64);
+#endif
+	}
+};
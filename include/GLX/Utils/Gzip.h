@@ -0,0 +1,335 @@
+#pragma once
+
+#include "GLX/Preprocessor.h"
+#include "GLX/Types/DataTypes.h"
+#include "GLX/Containers/DynamicArray.h"
+#include "GLX/FileSystem/FileIO.h"
+#include "GLX/FileSystem/FileSystem.h"
+#include "GLX/Utils/NonCopyable.h"
+
+namespace GlxNsPrivate
+{
+	// DEFLATE (RFC 1951) encoder that only emits fixed-Huffman blocks. Matches are found with hash chains over a 32 KiB
+	// window and never reach into an earlier block, so each block can be compressed on its own. Text such as log files
+	// typically shrinks to a quarter of its size or less.
+	class GlxDeflateEncoder : public GlxNonCopyable
+	{
+	public:
+		static GLX_CONSTEXPR GlxInt32 WindowSize = 1 << 15;
+		static GLX_CONSTEXPR GlxInt32 MinMatch = 3;
+		static GLX_CONSTEXPR GlxInt32 MaxMatch = 258;
+		static GLX_CONSTEXPR GlxInt32 HashBits = 15;
+		static GLX_CONSTEXPR GlxInt32 MaxChainLength = 32;
+
+		explicit GlxDeflateEncoder(GlxDynamicArray<GlxUInt8>& OutBytes)
+			: Output(OutBytes)
+		{
+			Head = static_cast<GlxInt32*>(GLX_MALLOC((1 << HashBits) * sizeof(GlxInt32)));
+			Prev = static_cast<GlxInt32*>(GLX_MALLOC(WindowSize * sizeof(GlxInt32)));
+		}
+
+		~GlxDeflateEncoder()
+		{
+			GLX_FREE(Head);
+			GLX_FREE(Prev);
+		}
+
+		// Appends InData as one block. Whole bytes go to the output right away; a partial byte waits for the next block
+		// or for Finish().
+		void CompressBlock(const GlxUInt8* InData, GlxInt64 InSize, GlxBool InFinal)
+		{
+			WriteBits(InFinal ? 1u : 0u, 1);
+			WriteBits(1u, 2);
+
+			for (GlxInt32 Index = 0; Index < (1 << HashBits); ++Index)
+			{
+				Head[Index] = -1;
+			}
+
+			GlxInt64 Pos = 0;
+
+			while (Pos < InSize)
+			{
+				GlxInt32 BestLength = 0;
+				GlxInt64 BestDistance = 0;
+
+				if (Pos + MinMatch <= InSize)
+				{
+					const GlxUInt32 Hash = HashAt(InData + Pos);
+					const GlxInt64 MaxLength = GLX_MIN(static_cast<GlxInt64>(MaxMatch), InSize - Pos);
+
+					GlxInt64 Candidate = Head[Hash];
+
+					for (GlxInt32 Chain = 0; Chain < MaxChainLength && Candidate >= 0 && Candidate < Pos && Pos - Candidate <= WindowSize; ++Chain)
+					{
+						GlxInt32 Length = 0;
+
+						while (Length < MaxLength && InData[Candidate + Length] == InData[Pos + Length])
+						{
+							++Length;
+						}
+
+						if (Length > BestLength)
+						{
+							BestLength = Length;
+							BestDistance = Pos - Candidate;
+
+							if (Length == MaxLength)
+							{
+								break;
+							}
+						}
+
+						Candidate = Prev[Candidate & (WindowSize - 1)];
+					}
+
+					Insert(Pos, Hash);
+				}
+
+				if (BestLength >= MinMatch)
+				{
+					WriteMatch(BestLength, static_cast<GlxInt32>(BestDistance));
+
+					for (GlxInt64 Next = Pos + 1; Next < Pos + BestLength && Next + MinMatch <= InSize; ++Next)
+					{
+						Insert(Next, HashAt(InData + Next));
+					}
+
+					Pos += BestLength;
+				}
+				else
+				{
+					WriteSymbol(InData[Pos]);
+					++Pos;
+				}
+			}
+
+			WriteSymbol(256);
+		}
+
+		// Pads the last byte with zero bits.
+		void Finish()
+		{
+			if (BitCount > 0)
+			{
+				Output.EmplaceBack(static_cast<GlxUInt8>(BitBuffer));
+				BitBuffer = 0;
+				BitCount = 0;
+			}
+		}
+
+	private:
+		static GLX_FORCE_INLINE GlxUInt32 HashAt(const GlxUInt8* InData)
+		{
+			const GlxUInt32 Value = static_cast<GlxUInt32>(InData[0]) | (static_cast<GlxUInt32>(InData[1]) << 8) | (static_cast<GlxUInt32>(InData[2]) << 16);
+			return (Value * 0x9E3779B1u) >> (32 - HashBits);
+		}
+
+		GLX_FORCE_INLINE void Insert(GlxInt64 InPos, GlxUInt32 InHash)
+		{
+			Prev[InPos & (WindowSize - 1)] = Head[InHash];
+			Head[InHash] = static_cast<GlxInt32>(InPos);
+		}
+
+		// Stream bits are packed starting from the least significant bit of each byte.
+		GLX_FORCE_INLINE void WriteBits(GlxUInt32 InValue, GlxInt32 InCount)
+		{
+			BitBuffer |= static_cast<GlxUInt64>(InValue) << BitCount;
+			BitCount += InCount;
+
+			while (BitCount >= 8)
+			{
+				Output.EmplaceBack(static_cast<GlxUInt8>(BitBuffer));
+				BitBuffer >>= 8;
+				BitCount -= 8;
+			}
+		}
+
+		// Huffman codes are stored most significant bit first.
+		GLX_FORCE_INLINE void WriteCode(GlxUInt32 InCode, GlxInt32 InLength)
+		{
+			GlxUInt32 Reversed = 0;
+
+			for (GlxInt32 Index = 0; Index < InLength; ++Index)
+			{
+				Reversed = (Reversed << 1) | ((InCode >> Index) & 1u);
+			}
+
+			WriteBits(Reversed, InLength);
+		}
+
+		// Fixed literal/length code (RFC 1951, 3.2.6).
+		GLX_FORCE_INLINE void WriteSymbol(GlxUInt32 InSymbol)
+		{
+			if (InSymbol < 144)
+			{
+				WriteCode(0x30 + InSymbol, 8);
+			}
+			else if (InSymbol < 256)
+			{
+				WriteCode(0x190 + InSymbol - 144, 9);
+			}
+			else if (InSymbol < 280)
+			{
+				WriteCode(InSymbol - 256, 7);
+			}
+			else
+			{
+				WriteCode(0xC0 + InSymbol - 280, 8);
+			}
+		}
+
+		void WriteMatch(GlxInt32 InLength, GlxInt32 InDistance)
+		{
+			static GLX_CONSTEXPR GlxInt32 LengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+			static GLX_CONSTEXPR GlxInt32 LengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+			static GLX_CONSTEXPR GlxInt32 DistanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+			static GLX_CONSTEXPR GlxInt32 DistanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+			GlxInt32 LengthCode = 28;
+			while (LengthBase[LengthCode] > InLength)
+			{
+				--LengthCode;
+			}
+
+			WriteSymbol(257 + LengthCode);
+			WriteBits(static_cast<GlxUInt32>(InLength - LengthBase[LengthCode]), LengthExtra[LengthCode]);
+
+			GlxInt32 DistanceCode = 29;
+			while (DistanceBase[DistanceCode] > InDistance)
+			{
+				--DistanceCode;
+			}
+
+			WriteCode(static_cast<GlxUInt32>(DistanceCode), 5);
+			WriteBits(static_cast<GlxUInt32>(InDistance - DistanceBase[DistanceCode]), DistanceExtra[DistanceCode]);
+		}
+
+		GlxDynamicArray<GlxUInt8>& Output;
+		GlxInt32* Head;
+		GlxInt32* Prev;
+		GlxUInt64 BitBuffer = 0;
+		GlxInt32 BitCount = 0;
+	};
+}
+
+// gzip (RFC 1952) compression of whole files, readable by gzip, zlib and every archive tool.
+class GLX_API GlxGzip
+{
+public:
+	static GLX_CONSTEXPR GlxInt64 BlockSize = 1 << 20;
+
+	// Streams InSource into a new gzip file at InDest, BlockSize bytes at a time. Returns false if either file cannot
+	// be opened or a read or write fails; InDest may then hold a partial file.
+	static GlxBool CompressFile(const GlxPath& InSource, const GlxPath& InDest);
+
+	// Continues the CRC-32 InCrc (0 to start) over InSize bytes.
+	static GlxUInt32 Crc32(const void* InData, GlxSizeT InSize, GlxUInt32 InCrc = 0);
+};
+
+GlxBool GlxGzip::CompressFile(const GlxPath& InSource, const GlxPath& InDest)
+{
+	GlxFileReader Reader(InSource, GlxEOpenMode::Read | GlxEOpenMode::Binary);
+	GlxFileWriter Writer(InDest, GlxEOpenMode::Write | GlxEOpenMode::Truncate | GlxEOpenMode::Binary);
+
+	if (!Reader.IsOpen() || !Writer.IsOpen())
+	{
+		return false;
+	}
+
+	// Magic, deflate, no flags, no modification time, no extra flags, unknown OS.
+	static const GlxUInt8 Header[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+
+	GlxDynamicArray<GlxUInt8> Output;
+	Output.Reserve(BlockSize / 2);
+	Output.Append(10, Header);
+
+	GlxUInt8* Input = static_cast<GlxUInt8*>(GLX_MALLOC(BlockSize));
+	GlxNsPrivate::GlxDeflateEncoder Encoder(Output);
+
+	const GlxInt64 FileSize = static_cast<GlxInt64>(Reader.GetFileSize());
+	GlxInt64 Remaining = FileSize;
+	GlxUInt32 Crc = 0;
+	GlxBool Succeeded = true;
+
+	do
+	{
+		const GlxInt64 Size = GLX_MIN(BlockSize, Remaining);
+
+		if (Size > 0 && (!Reader.Read(Input, Size) || !Reader))
+		{
+			Succeeded = false;
+			break;
+		}
+
+		Remaining -= Size;
+		Crc = Crc32(Input, static_cast<GlxSizeT>(Size), Crc);
+		Encoder.CompressBlock(Input, Size, Remaining == 0);
+
+		if (Remaining == 0)
+		{
+			Encoder.Finish();
+
+			// CRC-32 and size modulo 2^32, both little-endian.
+			const GlxUInt32 Trailer[2] = { Crc, static_cast<GlxUInt32>(FileSize) };
+
+			for (GlxUInt32 Value : Trailer)
+			{
+				for (GlxInt32 Shift = 0; Shift < 32; Shift += 8)
+				{
+					Output.EmplaceBack(static_cast<GlxUInt8>(Value >> Shift));
+				}
+			}
+		}
+
+		if (!Writer.Write(Output.GetData(), Output.GetElementCount()) || !Writer)
+		{
+			Succeeded = false;
+			break;
+		}
+
+		Output.Clear();
+	} while (Remaining > 0);
+
+	GLX_FREE(Input);
+	Writer.Close();
+	return Succeeded && Writer;
+}
+
+GlxUInt32 GlxGzip::Crc32(const void* InData, GlxSizeT InSize, GlxUInt32 InCrc)
+{
+	class GlxTable
+	{
+	public:
+		GlxUInt32 Values[256];
+	};
+
+	static const GlxTable Table = []()
+	{
+		GlxTable Result;
+
+		for (GlxUInt32 Index = 0; Index < 256; ++Index)
+		{
+			GlxUInt32 Value = Index;
+
+			for (GlxInt32 Bit = 0; Bit < 8; ++Bit)
+			{
+				Value = (Value & 1u) ? (0xEDB88320u ^ (Value >> 1)) : (Value >> 1);
+			}
+
+			Result.Values[Index] = Value;
+		}
+
+		return Result;
+	}();
+
+	const GlxUInt8* Bytes = static_cast<const GlxUInt8*>(InData);
+	GlxUInt32 Crc = ~InCrc;
+
+	for (GlxSizeT Index = 0; Index < InSize; ++Index)
+	{
+		Crc = Table.Values[(Crc ^ Bytes[Index]) & 0xFFu] ^ (Crc >> 8);
+	}
+
+	return ~Crc;
+}
@@ -1,40 +1,62 @@
 #pragma once
 
 #include "GLX/String/String.h"
+#include "GLX/String/StringView.h"
 #include "GLX/Math/Math.h"
+#include "GLX/Utils/NonCopyable.h"
 
 #include <cstring>
 #include <cmath>
+#include <type_traits>
+#include <limits>
+
+#include <random>
 
 #include "../ThirdParty/xxHash/xxhash.h"
 
+// Defining GLX_XXH3_DISPATCH (and compiling ThirdParty/xxHash/xxh_x86dispatch.c into the build) makes XXH3 pick its
+// scalar/SSE2/AVX2/AVX-512 kernel at runtime instead of using the one the compiler targets.
+#if defined(GLX_XXH3_DISPATCH) && defined(GLX_CPU_ARCH_X86)
+	#include "../ThirdParty/xxHash/xxh_x86dispatch.h"
+#endif
+
 template<typename TKey, typename TCondition = void>
 class GlxHasher;
 
+// A hasher opts into heterogeneous lookup by declaring 'using IsTransparent = void;' and providing extra GetHashCode
+// overloads that hash equal to the key type (e.g. GlxHasher<GlxString> hashes 'const GlxChar*' without building a GlxString).
+template<typename THasher, typename = void>
+class GlxIsTransparentHasher : public GlxFalseType
+{};
+
+template<typename THasher>
+class GlxIsTransparentHasher<THasher, std::void_t<typename THasher::IsTransparent>> : public GlxTrueType
+{};
+
 namespace GlxNsHash
 {
-#if defined(GLX_PLATFORM_WIN64)
-	GLX_CONSTEXPR GlxSizeT FNV_OffsetBasis = 14695981039346656037ULL;
-	GLX_CONSTEXPR GlxSizeT FNV_Prime = 1099511628211ULL;
-#else
-	GLX_CONSTEXPR GlxSizeT FNV_OffsetBasis = 2166136261U;
-	GLX_CONSTEXPR GlxSizeT FNV_Prime = 16777619U;
-#endif
+	template<typename TChar>
+	GLX_FORCE_INLINE GlxSizeT GetHashCodeFromString(const TChar* InStr, GlxSizeT InLen) noexcept
+	{
+		return static_cast<GlxSizeT>(XXH3_64bits(InStr, InLen * sizeof(TChar)));
+	}
 
 	template<typename TChar>
-	GlxSizeT GetHashCodeFromString(const TChar* InStr, GlxSizeT InLen) noexcept
+	GLX_FORCE_INLINE GlxSizeT GetHashCodeFromString(const TChar* InStr, GlxSizeT InLen, GlxUInt64 InSeed) noexcept
 	{
-		const GlxSizeT Count = InLen * sizeof(TChar);
-		const unsigned char* const Data = reinterpret_cast<const unsigned char*>(InStr);
+		return static_cast<GlxSizeT>(XXH3_64bits_withSeed(InStr, InLen * sizeof(TChar), InSeed));
+	}
 
-		GlxSizeT HashCode = FNV_OffsetBasis;
-		for (GlxSizeT Idx = 0; Idx < Count; ++Idx)
+	// Random per process, so hash values of attacker-chosen keys can't be predicted offline.
+	inline GlxUInt64 GetProcessSeed()
+	{
+		static const GlxUInt64 Seed = []()
 		{
-			HashCode ^= static_cast<GlxSizeT>(Data[Idx]);
-			HashCode *= FNV_Prime;
-		}
+			std::random_device Device;
+			return (static_cast<GlxUInt64>(Device()) << 32) ^ static_cast<GlxUInt64>(Device());
+		}();
 
-		return HashCode;
+		return Seed;
 	}
 
 	template<typename... TRest>
@@ -77,31 +99,176 @@ template<>
 class GlxHasher<GlxString>
 {
 public:
+	using IsTransparent = void;
+
 	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxString& InStr)
 	{
 		return GlxNsHash::GetHashCodeFromString<GlxChar>(InStr.GetData(), InStr.GetElementCount());
 	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxChar* InStr)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxChar>(InStr, strlen(InStr));
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxChar* InStr, GlxSizeT InLen)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxChar>(InStr, InLen);
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(GlxStringView InStr)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxChar>(InStr.GetData(), InStr.GetElementCount());
+	}
 };
 
 template<>
 class GlxHasher<GlxWString>
 {
 public:
+	using IsTransparent = void;
+
 	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxWString& InStr)
 	{
 		return GlxNsHash::GetHashCodeFromString<GlxWChar>(InStr.GetData(), InStr.GetElementCount());
 	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxWChar* InStr)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxWChar>(InStr, wcslen(InStr));
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const GlxWChar* InStr, GlxSizeT InLen)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxWChar>(InStr, InLen);
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(GlxWStringView InStr)
+	{
+		return GlxNsHash::GetHashCodeFromString<GlxWChar>(InStr.GetData(), InStr.GetElementCount());
+	}
 };
 
+template<>
+class GlxHasher<GlxStringView> : public GlxHasher<GlxString>
+{
+};
+
+template<>
+class GlxHasher<GlxWStringView> : public GlxHasher<GlxWString>
+{
+};
+
+// String hasher keyed with GlxNsHash::GetProcessSeed(), for maps filled from untrusted input, e.g.
+// GlxHashMap<GlxString, TValue, GlxSeededStringHasher<GlxChar>>. Hash values differ from run to run.
+template<typename TChar>
+class GlxSeededStringHasher
+{
+public:
+	using IsTransparent = void;
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(GlxBasicStringView<TChar> InStr)
+	{
+		return GlxNsHash::GetHashCodeFromString<TChar>(InStr.GetData(), static_cast<GlxSizeT>(InStr.GetElementCount()), GlxNsHash::GetProcessSeed());
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const TChar* InStr)
+	{
+		return GetHashCode(GlxBasicStringView<TChar>(InStr));
+	}
+
+	static GLX_FORCE_INLINE GlxSizeT GetHashCode(const TChar* InStr, GlxSizeT InLen)
+	{
+		return GlxNsHash::GetHashCodeFromString<TChar>(InStr, InLen, GlxNsHash::GetProcessSeed());
+	}
+};
+
+namespace GlxNsHash
+{
+	// Murmur3's 64-bit finalizer. Every input bit flips each output bit with probability close to 1/2, and the mix is a
+	// bijection, so distinct 8-byte keys never share a hash.
+	GLX_FORCE_INLINE GLX_CONSTEXPR GlxUInt64 MixBits64(GlxUInt64 InVal)
+	{
+		InVal ^= InVal >> 33;
+		InVal *= 0xFF51AFD7ED558CCDull;
+		InVal ^= InVal >> 33;
+		InVal *= 0xC4CEB9FE1A85EC53ull;
+		InVal ^= InVal >> 33;
+		return InVal;
+	}
+
+	// Same shape for keys of up to 4 bytes, minus the first shift, which would only ever see zeros. Also a bijection.
+	GLX_FORCE_INLINE GLX_CONSTEXPR GlxUInt64 MixBits32(GlxUInt32 InVal)
+	{
+		GlxUInt64 Val = InVal * 0x9E3779B97F4A7C15ull;
+		Val ^= Val >> 32;
+		Val *= 0xD6E8FEB86659FD93ull;
+		Val ^= Val >> 32;
+		return Val;
+	}
+}
+
 namespace GlxNsPrivate
 {
+	// Integer keys are widened to an unsigned value of the same width and mixed inline; the mixer is picked by size at
+	// compile time. Floating-point keys hash their bits after folding -0.0 into 0.0 and every NaN into one quiet NaN, so
+	// values that compare equal (or are all "not a number") land in the same bucket.
 	template<typename TArithmetic, typename = typename GlxEnableIf<GlxIsArithmetic<TArithmetic>::Value>::Type>
 	class GlxDefaultHasher
 	{
 	public:
 		static GLX_FORCE_INLINE GlxSizeT GetHashCode(TArithmetic InVal)
 		{
-			return XXH64(&InVal, sizeof(TArithmetic), 0);
+			if constexpr (GlxIsFloatingPoint<TArithmetic>::Value)
+			{
+				return HashFloat(InVal);
+			}
+			else if constexpr (GlxIsSame<TArithmetic, GlxBool>::Value)
+			{
+				return static_cast<GlxSizeT>(GlxNsHash::MixBits32(InVal ? 1u : 0u));
+			}
+			else if constexpr (sizeof(TArithmetic) <= sizeof(GlxUInt32))
+			{
+				return static_cast<GlxSizeT>(GlxNsHash::MixBits32(static_cast<std::make_unsigned_t<TArithmetic>>(InVal)));
+			}
+			else
+			{
+				static_assert(sizeof(TArithmetic) == sizeof(GlxUInt64), "Integers wider than 64 bits are not supported.");
+				return static_cast<GlxSizeT>(GlxNsHash::MixBits64(static_cast<GlxUInt64>(InVal)));
+			}
+		}
+
+	private:
+		static GLX_FORCE_INLINE GlxSizeT HashFloat(GlxFloat InVal)
+		{
+			GlxUInt32 Bits;
+			InVal = (InVal != InVal) ? std::numeric_limits<GlxFloat>::quiet_NaN() : InVal + 0.0f;
+			std::memcpy(&Bits, &InVal, sizeof(Bits));
+			return static_cast<GlxSizeT>(GlxNsHash::MixBits32(Bits));
+		}
+
+		static GLX_FORCE_INLINE GlxSizeT HashFloat(GlxDouble InVal)
+		{
+			GlxUInt64 Bits;
+			InVal = (InVal != InVal) ? std::numeric_limits<GlxDouble>::quiet_NaN() : InVal + 0.0;
+			std::memcpy(&Bits, &InVal, sizeof(Bits));
+			return static_cast<GlxSizeT>(GlxNsHash::MixBits64(Bits));
+		}
+
+		// Where long double is wider than double its storage has padding bytes with unspecified contents, so the value is
+		// hashed as the double nearest to it plus the (exactly representable) remainder.
+		static GLX_FORCE_INLINE GlxSizeT HashFloat(GlxLongDouble InVal)
+		{
+			if constexpr (sizeof(GlxLongDouble) == sizeof(GlxDouble))
+			{
+				return HashFloat(static_cast<GlxDouble>(InVal));
+			}
+			else
+			{
+				const GlxDouble High = static_cast<GlxDouble>(InVal);
+				const GlxDouble Low = (InVal != InVal) ? 0.0 : static_cast<GlxDouble>(InVal - static_cast<GlxLongDouble>(High));
+				return HashFloat(High) ^ (HashFloat(Low) * 0x9E3779B97F4A7C15ull);
+			}
 		}
 	};
 }
@@ -183,3 +350,57 @@ public:
 		}
 	}
 };
+
+// Incremental XXH3 for data that arrives in pieces (large files, the fields of a composite key). Feeding the same bytes
+// in any split gives the same value as hashing them in one call.
+class GlxHashState : public GlxNonCopyable
+{
+public:
+	explicit GlxHashState(GlxUInt64 InSeed = 0)
+	{
+		Reset(InSeed);
+	}
+
+	GLX_FORCE_INLINE void Reset(GlxUInt64 InSeed = 0)
+	{
+		XXH3_64bits_reset_withSeed(&State, InSeed);
+	}
+
+	GLX_FORCE_INLINE void Update(const void* InData, GlxSizeT InSize)
+	{
+		XXH3_64bits_update(&State, InData, InSize);
+	}
+
+	template<typename T, typename = typename GlxEnableIf<GlxIsArithmetic<T>::Value || GlxIsEnum<T>::Value>::Type>
+	GLX_FORCE_INLINE void Update(const T& InValue)
+	{
+		Update(&InValue, sizeof(T));
+	}
+
+	// The length goes in first so that ("ab", "c") and ("a", "bc") hash differently.
+	GLX_FORCE_INLINE void UpdateString(GlxStringView InStr)
+	{
+		UpdateChars(InStr.GetData(), InStr.GetElementCount());
+	}
+
+	GLX_FORCE_INLINE void UpdateString(GlxWStringView InStr)
+	{
+		UpdateChars(InStr.GetData(), InStr.GetElementCount());
+	}
+
+	GLX_NODISCARD GLX_FORCE_INLINE GlxSizeT Finalize() const
+	{
+		return static_cast<GlxSizeT>(XXH3_64bits_digest(&State));
+	}
+
+private:
+	template<typename TChar>
+	GLX_FORCE_INLINE void UpdateChars(const TChar* InData, GlxInt64 InLength)
+	{
+		const GlxUInt64 Length = static_cast<GlxUInt64>(InLength);
+		Update(&Length, sizeof(Length));
+		Update(InData, Length * sizeof(TChar));
+	}
+
+	XXH3_state_t State;
+};